@@ -25,6 +25,11 @@ public:
 public:
     virtual std::string toString(size_t level = 0) const noexcept = 0;
 
+public:
+    /* appends a key that is equal for structurally equal subtrees regardless of where they are, false if the
+     * subtree refers to groups and so depends on the rest of the pattern */
+    virtual bool appendKey(std::string &key) const noexcept = 0;
+
 private:
     template <typename NodeType>
     inline NodeType *setPosition(ssize_t pos)
@@ -42,6 +47,20 @@ public:
     }
 };
 
+/** Matching flags **/
+
+struct Flags
+{
+    enum : int
+    {
+        FlagDotAll     = 1 << 0,    /* (?s), '.' also matches '\n' */
+        FlagExtended   = 1 << 1,    /* (?x), white spaces and '#' comments are ignored */
+        FlagMultiLine  = 1 << 2,    /* (?m), '^' and '$' also match around '\n' */
+        FlagIgnoreCase = 1 << 3,    /* (?i), case-insensitive matching using simple case folding */
+        FlagRejectRisky = 1 << 4,   /* refuse patterns that may backtrack exponentially, can't be set inline */
+    };
+};
+
 /** Forward declarations **/
 
 struct RegExp;
@@ -58,8 +77,12 @@ struct RegExp final : public Node
 {
     std::vector<std::shared_ptr<Section>> sections;
 
+public:
+    virtual ~RegExp();
+
 public:
     virtual std::string toString(size_t level) const noexcept;
+    virtual bool appendKey(std::string &key) const noexcept;
 
 };
 
@@ -69,6 +92,7 @@ struct Section final : public Node
 
 public:
     virtual std::string toString(size_t level) const noexcept;
+    virtual bool appendKey(std::string &key) const noexcept;
 
 };
 
@@ -108,6 +132,7 @@ public:
 
 public:
     Type type;
+    int flags = 0;
     Modifier modifier;
 
 public:
@@ -117,6 +142,7 @@ public:
 
 public:
     virtual std::string toString(size_t level) const noexcept;
+    virtual bool appendKey(std::string &key) const noexcept;
 
 };
 
@@ -127,6 +153,7 @@ struct Range final : public Node
 
 public:
     virtual std::string toString(size_t level) const noexcept;
+    virtual bool appendKey(std::string &key) const noexcept;
 
 };
 
@@ -151,6 +178,7 @@ public:
 
 public:
     virtual std::string toString(size_t level) const noexcept;
+    virtual bool appendKey(std::string &key) const noexcept;
 
 };
 
@@ -168,6 +196,9 @@ struct Character final : public Node
         CharacterNonSpace,
         CharacterNonBorder,
 
+        CharacterProperty,          /* general category or script called `name` */
+        CharacterNonProperty,
+
         CharacterSimple,
         CharacterControl,
         CharacterReference,
@@ -189,6 +220,7 @@ public:
 
 public:
     virtual std::string toString(size_t level) const noexcept;
+    virtual bool appendKey(std::string &key) const noexcept;
 
 };
 }
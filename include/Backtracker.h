@@ -0,0 +1,101 @@
+#ifndef FASTREGEXP_BACKTRACKER_H
+#define FASTREGEXP_BACKTRACKER_H
+
+#include <vector>
+#include <cstdint>
+#include <sys/types.h>
+
+#include "Budget.h"
+#include "Program.h"
+
+namespace FastRegExp
+{
+class Backtracker
+{
+    struct Frame
+    {
+        enum class Type : int
+        {
+            FrameBranch,
+            FrameRepeat,
+            FrameLazyRepeat,
+            FrameRestoreSlot,
+            FrameRestoreRegister,
+        };
+
+    public:
+        Type type;
+        size_t pc;
+        size_t pos;
+        ssize_t value;
+
+    };
+
+private:
+    Budget *_budget;
+    const Program &_program;
+    std::vector<Frame> _stack;
+    std::vector<ssize_t> _slots;
+    std::vector<ssize_t> _registers;
+
+private:
+    bool _memoize;
+    size_t _stale = SIZE_MAX;       /* position where the previous match ended, states there were not failures */
+    size_t _empty = SIZE_MAX;       /* position where the match may not be empty */
+    std::vector<bool> _visited;     /* states `pos * code.size() + pc` already visited, when memoizing */
+
+public:
+    /* inputs are memoized up to this many states, longer ones are backtracked as usual */
+    static const size_t MaxVisited = 32 * 1024 * 1024;
+
+public:
+    /* patterns that may backtrack excessively remember failed states, so each is visited only once. steps are
+     * spent from `budget` if given, matching fails once it's exceeded */
+    explicit Backtracker(const Program &program, Budget *budget = nullptr) :
+        _budget(budget), _program(program), _slots((program.groups + 1) * 2, -1), _registers(program.registers, 0),
+        _memoize(program.analysis.riskPos >= 0 && program.analysis.isMemoizable) {}
+
+public:
+    static inline bool isAlpha(uint8_t ch)
+    {
+        return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z');
+    }
+
+public:
+    static inline bool isWord(uint8_t ch)
+    {
+        return (ch >= 'a' && ch <= 'z') ||
+               (ch >= 'A' && ch <= 'Z') ||
+               (ch >= '0' && ch <= '9') ||
+               (ch == '_');
+    }
+
+public:
+    /* UTF-8 continuation byte, no match starts or ends inside a character */
+    static inline bool isContinuation(uint8_t ch)
+    {
+        return (ch & 0xc0) == 0x80;
+    }
+
+private:
+    bool checkAssertion(const uint8_t *str, size_t len, size_t pos, Instruction::Assertion assertion) const;
+    bool run(const uint8_t *str, size_t len, size_t pc, size_t pos, size_t base = 0);
+
+private:
+    bool lookFixed(const uint8_t *str, size_t len, size_t pos, const Instruction &ins) const;
+    bool lookaround(const uint8_t *str, size_t len, size_t pos, const Instruction &ins);
+
+public:
+    const std::vector<ssize_t> &slots(void) const { return _slots; }
+
+public:
+    /* find the leftmost match starting at or after `start`, captured positions are available from `slots()`.
+     * `resume` continues on the same input after the previous match, keeping the states known to fail.
+     * `isNonEmpty` refuses an empty match at `start`, for searching again after one was found there. also false
+     * once the budget is exceeded */
+    bool exec(const char *str, size_t len, size_t start, bool resume = false, bool isNonEmpty = false);
+
+};
+}
+
+#endif /* FASTREGEXP_BACKTRACKER_H */
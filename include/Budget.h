@@ -0,0 +1,76 @@
+#ifndef FASTREGEXP_BUDGET_H
+#define FASTREGEXP_BUDGET_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+namespace FastRegExp
+{
+/* limits on the work of a single match call, the engines give up once any of them is exceeded. unset limits
+ * are unlimited, and the counters start over with every call the budget is given to */
+class Budget
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+public:
+    enum class Result : int
+    {
+        ResultMatch,
+        ResultNoMatch,
+        ResultExceeded,
+    };
+
+private:
+    size_t _steps = 0;
+    size_t _states = 0;
+    size_t _next = 0;           /* steps at which the limits are checked again */
+    bool _isExceeded = false;
+
+public:
+    size_t steps = 0;                                   /* backtracks, backward jumps and start positions of the
+                                                         * backtracker plus bytes walked by the DFAs, 0 if unlimited */
+    size_t states = 0;                                  /* states created by the lazy DFA, 0 if unlimited */
+    Clock::time_point deadline = Clock::time_point::max();
+    const std::atomic<bool> *cancel = nullptr;          /* set from any thread to stop the match */
+
+public:
+    /* the clock and `cancel` are read once every this many steps */
+    static const size_t Interval = 256;
+
+public:
+    /* DFAs spend their steps this many bytes at a time */
+    static const size_t Block = 16 * 1024;
+
+public:
+    explicit Budget() {}
+    explicit Budget(Clock::duration timeout) : deadline(Clock::now() + timeout) {}
+
+public:
+    size_t stepsUsed(void) const { return _steps; }
+    size_t statesUsed(void) const { return _states; }
+    bool isExceeded(void) const { return _isExceeded; }
+
+private:
+    bool check(void);
+
+public:
+    void reset(void);
+
+public:
+    /* false once exceeded, the limits are only checked when enough steps were spent since the last time */
+    inline bool spend(size_t count = 1)
+    {
+        _steps += count;
+        return _steps < _next || check();
+    }
+
+public:
+    /* counts a new DFA state, false once exceeded */
+    bool create(void);
+
+};
+}
+
+#endif /* FASTREGEXP_BUDGET_H */
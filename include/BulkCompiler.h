@@ -0,0 +1,46 @@
+#ifndef FASTREGEXP_BULKCOMPILER_H
+#define FASTREGEXP_BULKCOMPILER_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "RegExp.h"
+#include "SyntaxError.h"
+
+namespace FastRegExp
+{
+/* compiles large sets of patterns on several threads, each pattern is parsed and compiled on it's own */
+class BulkCompiler
+{
+    size_t _threads;
+
+public:
+    struct Error
+    {
+        size_t index;           /* of the pattern in the input */
+        SyntaxError error;
+    };
+
+public:
+    /* patterns are handed out this many at a time, so cheap ones don't contend on the counter */
+    static const size_t Batch = 16;
+
+public:
+    /* uses every hardware thread if `threads` is 0 */
+    explicit BulkCompiler(size_t threads = 0);
+
+public:
+    size_t threads(void) const { return _threads; }
+
+public:
+    /* results are in the order of `patterns`, null for the ones that failed. `errors` is cleared and receives
+     * every syntax error ordered by index, so the output doesn't depend on scheduling. exceptions other than
+     * syntax errors are rethrown once every thread has finished. sub-patterns repeated across `patterns` are
+     * compiled once if `fragments` is given */
+    std::vector<std::shared_ptr<RegExp>> compile(const std::vector<std::string> &patterns, int flags, std::vector<Error> &errors, Fragments *fragments = nullptr) const;
+
+};
+}
+
+#endif /* FASTREGEXP_BULKCOMPILER_H */
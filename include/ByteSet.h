@@ -0,0 +1,48 @@
+#ifndef FASTREGEXP_BYTESET_H
+#define FASTREGEXP_BYTESET_H
+
+#include <string>
+#include <cstdint>
+
+namespace FastRegExp
+{
+class ByteSet
+{
+    uint64_t _bits[4] = {};
+
+public:
+    inline void add(uint8_t ch) { _bits[ch >> 6] |= 1ull << (ch & 63); }
+    inline bool test(uint8_t ch) const { return (_bits[ch >> 6] >> (ch & 63)) & 1; }
+
+public:
+    inline void addRange(uint8_t lower, uint8_t upper)
+    {
+        for (unsigned int ch = lower; ch <= upper; ch++)
+            add(static_cast<uint8_t>(ch));
+    }
+
+public:
+    inline bool operator==(const ByteSet &other) const
+    {
+        return _bits[0] == other._bits[0] &&
+               _bits[1] == other._bits[1] &&
+               _bits[2] == other._bits[2] &&
+               _bits[3] == other._bits[3];
+    }
+
+public:
+    size_t count(void) const
+    {
+        return __builtin_popcountll(_bits[0]) +
+               __builtin_popcountll(_bits[1]) +
+               __builtin_popcountll(_bits[2]) +
+               __builtin_popcountll(_bits[3]);
+    }
+
+public:
+    std::string toString(void) const;
+
+};
+}
+
+#endif /* FASTREGEXP_BYTESET_H */
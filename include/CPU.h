@@ -0,0 +1,45 @@
+#ifndef FASTREGEXP_CPU_H
+#define FASTREGEXP_CPU_H
+
+namespace FastRegExp
+{
+namespace CPU
+{
+enum Feature : int
+{
+    FeatureSSE2         = 1 << 0,
+    FeatureSSSE3        = 1 << 1,
+    FeatureSSE42        = 1 << 2,
+    FeatureAVX2         = 1 << 3,
+    FeatureAVX512BW     = 1 << 4,
+    FeatureBMI2         = 1 << 5,
+};
+
+/* each tier requires the features of the ones below it */
+enum class Tier : int
+{
+    TierScalar,
+    TierSSE2,
+    TierSSSE3,
+    TierSSE42,
+    TierAVX2,
+    TierAVX512,
+};
+
+/* features of the running CPU, detected once. the `FASTREGEXP_CPU` environment variable (`scalar`, `sse2`,
+ * `ssse3`, `sse4.2`, `avx2` or `avx512`) limits them the same way `limit` does */
+int detected(void);
+
+/* detected features not above the limit, and the highest tier they make up */
+int features(void);
+Tier tier(void);
+
+/* forces kernels no higher than `tier`, patterns compiled before keep the kernels they selected */
+void limit(Tier tier);
+
+/* name of a tier, as accepted by `FASTREGEXP_CPU` */
+const char *nameOf(Tier tier);
+}
+}
+
+#endif /* FASTREGEXP_CPU_H */
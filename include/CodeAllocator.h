@@ -0,0 +1,113 @@
+#ifndef FASTREGEXP_CODEALLOCATOR_H
+#define FASTREGEXP_CODEALLOCATOR_H
+
+#include <map>
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace FastRegExp
+{
+class CodeAllocator;
+
+/* a function in executable memory, given back to it's allocator when destroyed */
+class Code
+{
+    size_t _size;
+    size_t _offset;
+    const uint8_t *_entry;
+
+private:
+    void *_chunk;
+    CodeAllocator *_allocator;
+
+private:
+    friend class CodeAllocator;
+    explicit Code(CodeAllocator *allocator, void *chunk, size_t offset, const uint8_t *entry, size_t size) :
+        _size(size), _offset(offset), _entry(entry), _chunk(chunk), _allocator(allocator) {}
+
+public:
+    ~Code();
+    Code(const Code &) = delete;
+    Code &operator=(const Code &) = delete;
+
+public:
+    size_t size(void) const { return _size; }
+    const void *entry(void) const { return _entry; }
+
+public:
+    template <typename Function>
+    Function *function(void) const { return reinterpret_cast<Function *>(reinterpret_cast<uintptr_t>(_entry)); }
+
+};
+
+/* packs functions into shared chunks of executable memory. no page is ever writable and executable at the same
+ * address: chunks are mapped twice from the same memory object, once for writing and once for executing. where
+ * that is not possible every function gets pages of it's own, written first and then made executable */
+class CodeAllocator
+{
+    struct Chunk
+    {
+        size_t size;
+        size_t used;
+        uint8_t *writable;                  /* null once sealed, for functions on pages of their own */
+        uint8_t *executable;
+        std::map<size_t, size_t> free;      /* offset to size of free blocks, merged with their neighbours */
+    };
+
+public:
+    struct Usage
+    {
+        size_t used = 0;                    /* bytes of functions, rounded to `Alignment` */
+        size_t mapped = 0;                  /* bytes of executable memory */
+        size_t chunks = 0;
+        size_t functions = 0;
+    };
+
+private:
+    Usage _usage;
+    bool _isShared;
+    std::mutex _mutex;
+    std::vector<std::unique_ptr<Chunk>> _chunks;
+
+public:
+    /* functions start on cache lines */
+    static const size_t Alignment = 64;
+
+public:
+    /* chunks are mapped this size, unless a function is bigger or huge pages are asked for by `Pages::policy` */
+    static const size_t ChunkSize = 64 * 1024;
+
+public:
+    explicit CodeAllocator();
+    ~CodeAllocator();
+
+public:
+    CodeAllocator(const CodeAllocator &) = delete;
+    CodeAllocator &operator=(const CodeAllocator &) = delete;
+
+public:
+    /* the allocator used by compiled patterns, never destroyed so code may outlive static destructors */
+    static CodeAllocator &instance(void);
+
+private:
+    bool mapShared(Chunk &chunk);
+    void unmap(Chunk &chunk);
+
+private:
+    friend class Code;
+    void release(void *chunk, size_t offset, size_t size);
+
+public:
+    /* copies `size` bytes of machine code into executable memory, throws `std::bad_alloc` if it can't be mapped */
+    std::shared_ptr<Code> allocate(const void *code, size_t size);
+
+public:
+    Usage usage(void);
+
+};
+}
+
+#endif /* FASTREGEXP_CODEALLOCATOR_H */
@@ -0,0 +1,128 @@
+#ifndef FASTREGEXP_COMPILER_H
+#define FASTREGEXP_COMPILER_H
+
+#include <memory>
+#include <vector>
+#include <utility>
+#include <functional>
+#include <unordered_map>
+
+#include "AST.h"
+#include "Parser.h"
+#include "Program.h"
+#include "Fragments.h"
+
+namespace FastRegExp
+{
+class Compiler
+{
+    Program _program;
+    const Parser &_parser;
+    Fragments *_fragments;
+
+private:
+    bool _isRecording = false;      /* compiling a fragment, the elements within are not looked up on their own */
+
+private:
+    std::unordered_map<const AST::RegExp *, size_t> _indexes;
+
+public:
+    typedef std::vector<std::pair<char32_t, char32_t>> Ranges;
+
+public:
+    /* repetitions up to this count are unrolled, larger ones use counters */
+    static const size_t MaxUnroll = 8;
+
+public:
+    /* repetitions up to `DFA::MaxRepeat` are unrolled as well while their copies take at most this many
+     * instructions, so larger bounds keep the DFA and memoization */
+    static const size_t MaxUnrollSize = 1024;
+
+public:
+    /* fixed-width look-arounds up to this many bytes are compared in place */
+    static const size_t MaxLookWidth = 256;
+
+public:
+    /* sub-patterns are looked up in and added to `fragments` if given */
+    explicit Compiler(const Parser &parser, Fragments *fragments = nullptr) : _parser(parser), _fragments(fragments) {}
+
+private:
+    size_t emit(Instruction::Opcode opcode, size_t index = 0);
+    size_t addSet(const ByteSet &set);
+    size_t groupOf(const AST::RegExp *expr, ssize_t pos) const;
+
+private:
+    static bool isNullable(const AST::RegExp &node);
+    static bool isNullable(const AST::Elementry &node);
+
+private:
+    static void widthOf(const AST::RegExp &node, size_t &lower, ssize_t &upper);
+    static void widthOf(const AST::Elementry &node, size_t &lower, ssize_t &upper);
+
+private:
+    static bool unitsOf(const AST::RegExp &node, std::vector<ByteSet> &units);
+    static bool unitsOf(const AST::Elementry &node, std::vector<ByteSet> &units);
+
+private:
+    static bool rangesOf(const AST::Elementry &node, Ranges &ranges);
+    static void rangesOf(const AST::Character &node, Ranges &ranges);
+
+private:
+    static void charsOf(const AST::RegExp &node, Ranges &ranges);
+    static void charsOf(const AST::Elementry &node, Ranges &ranges);
+
+private:
+    static void firstOf(const AST::RegExp &node, Ranges &ranges);
+    static void firstOf(const AST::Elementry &node, Ranges &ranges);
+    static bool firstOf(const AST::Section &node, size_t begin, Ranges &ranges);
+
+private:
+    static bool isAnchored(const AST::RegExp &node, bool atEnd);
+    static bool isUnbounded(const AST::Elementry &node);
+    static bool isCounted(const AST::Elementry &node);
+    static bool isAmbiguous(const AST::RegExp &node, const Ranges &follow);
+    static bool isAmbiguous(const AST::Section &lhs, const AST::Section &rhs, const Ranges &follow);
+
+private:
+    void analyzeProgram(void);
+    void analyzeRegExp(const AST::RegExp &node);
+    void analyzeElementry(const AST::Elementry &node);
+
+private:
+    void compileAlternatives(size_t count, const std::function<void(size_t)> &compileOne);
+
+private:
+    void flushLiteral(Literal &literal);
+    static bool appendLiteral(const AST::Elementry &node, Literal &literal);
+
+private:
+    static bool isShareable(const AST::Elementry &node);
+    void loadFragment(const Fragments::Fragment &fragment);
+    std::shared_ptr<const Fragments::Fragment> saveFragment(size_t begin, size_t literals, size_t sequences, size_t registers) const;
+
+private:
+    void compileFragment (const AST::Elementry &node);
+    void compileRegExp   (const AST::RegExp    &node);
+    void compileSection  (const AST::Section   &node);
+    void compileElementry(const AST::Elementry &node);
+
+private:
+    /* whether `copies` copies of a repeated element are small enough to be unrolled, `isOptional` if some of
+     * them may be skipped */
+    bool isUnrollable(const AST::Elementry &node, size_t copies, bool isOptional);
+
+private:
+    void compileAtom     (const AST::Elementry &node);
+    void compileRanges   (const Ranges         &ranges);
+    void compileRepeat   (const AST::Elementry &node, size_t lower, ssize_t upper);
+    void compileSubExpr  (const AST::SubExpr   &node, int flags);
+    void compileLookaround(const AST::SubExpr  &node);
+    void compileCharacter(const AST::Character &node, int flags);
+
+public:
+    Program compile(const std::shared_ptr<AST::Node> &root);
+
+};
+}
+
+#endif /* FASTREGEXP_COMPILER_H */
@@ -0,0 +1,100 @@
+#ifndef FASTREGEXP_DFA_H
+#define FASTREGEXP_DFA_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+#include <sys/types.h>
+
+#include "Budget.h"
+#include "Program.h"
+
+namespace FastRegExp
+{
+/* lazily built DFA over the byte program, answers whether a match exists without captures */
+class DFA
+{
+    friend class DenseDFA;
+
+private:
+    struct State
+    {
+        int flags;
+        int accepts;                        /* match at the end of input, -1 if not computed yet */
+        std::vector<uint64_t> threads;      /* `pc << 32 | sub`, where `sub` is the offset into a
+                                             * literal or the iteration count of a `RepeatSet` */
+    };
+
+public:
+    enum : int
+    {
+        FlagStart   = 1 << 0,       /* nothing before the current position */
+        FlagWord    = 1 << 1,       /* previous byte is a word character */
+        FlagNewLine = 1 << 2,       /* previous byte is a new line */
+        FlagMatch   = 1 << 3,       /* a match ended right before the previous byte */
+        FlagDead    = 1 << 4,       /* no thread left in an anchored program, the rest of the input can't match */
+    };
+
+public:
+    /* one transition per byte value in each row of the table */
+    static const size_t Stride = 256;
+
+public:
+    /* the cache is flushed when it grows beyond this many states, keeping only the states in use */
+    static const size_t MaxStates = 4096;
+
+public:
+    /* number of inputs walked together by `execBatch` */
+    static const size_t Lanes = 8;
+
+public:
+    /* bounded `RepeatSet` counts are tracked in the state, so large ones are not supported */
+    static const size_t MaxRepeat = 64;
+
+private:
+    Budget *_budget;
+    const Program &_program;
+    std::vector<State> _states;
+    std::vector<int32_t> _table;
+    std::unordered_map<std::string, size_t> _cache;
+
+private:
+    uint32_t _epoch = 0;
+    std::vector<uint32_t> _visits;          /* the epoch each instruction was last reached by `closure` */
+    std::vector<uint64_t> _others;          /* reached threads with a non-zero `sub` */
+
+public:
+    /* `exec` spends bytes and new states from `budget` if given */
+    explicit DFA(const Program &program, Budget *budget = nullptr) :
+        _budget(budget), _program(program), _visits(program.code.size(), 0) {}
+
+public:
+    /* programs with back-references, look-arounds or counters need the backtracker */
+    static bool isSupported(const Program &program);
+
+private:
+    static int flagsOf(int ch);
+    static bool checkAssertion(Instruction::Assertion assertion, int flags, int next);
+
+private:
+    bool closure(const State &state, int next, std::vector<uint64_t> &threads);
+    size_t intern(int flags, std::vector<uint64_t> &&threads);
+
+private:
+    void flush(size_t *states, size_t count);
+    bool accepts(size_t state);
+    size_t transit(size_t state, uint8_t ch);
+
+public:
+    /* whether the program matches anywhere at or after `start`, false once the budget is exceeded */
+    bool exec(const char *str, size_t len, size_t start);
+
+public:
+    /* `exec` on every input from it's beginning, `Lanes` inputs are interleaved so their table lookups overlap */
+    void execBatch(const char *const *strs, const size_t *lens, size_t count, bool *results);
+
+};
+}
+
+#endif /* FASTREGEXP_DFA_H */
@@ -0,0 +1,98 @@
+#ifndef FASTREGEXP_DENSEDFA_H
+#define FASTREGEXP_DENSEDFA_H
+
+#include <array>
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+#include "DFA.h"
+#include "Budget.h"
+#include "Program.h"
+#include "TableAllocator.h"
+
+namespace FastRegExp
+{
+/* fully built and minimized DFA with byte classes and premultiplied transitions, immutable once built */
+class DenseDFA
+{
+    size_t _classes = 0;
+    size_t _stops = 0;                      /* walks end at premultiplied offsets at or above this one */
+    size_t _matches = 0;                    /* premultiplied offsets at or above this one are matching states, the
+                                             * state right below them never matches if `_stops` is lower */
+    std::array<uint8_t, 256> _map = {};     /* byte to it's class */
+    std::array<uint32_t, 4> _starts = {};   /* start state for each kind of preceding byte */
+
+private:
+    std::vector<bool> _accepts;             /* states matching at the end of input */
+    std::shared_ptr<const Table> _table;    /* transitions, placed by the `TableAllocator` */
+    bool _isNarrow = false;                 /* 16 bits per transition, when every premultiplied offset fits */
+
+public:
+    /* default budget for the transition table, in bytes */
+    static const size_t MaxTableSize = 256 * 1024;
+
+public:
+    /* states explored before minimizing, bounds the time spent building */
+    static const size_t MaxStates = 1024;
+
+public:
+    /* `execParallel` splits inputs into chunks of at least this many bytes */
+    static const size_t MinChunk = 1024 * 1024;
+
+public:
+    /* states walked together by `mapChunk` are merged every this many bytes */
+    static const size_t MergeInterval = 64;
+
+private:
+    static size_t startOf(int flags);
+    static void classify(const Program &program, std::array<uint8_t, 256> &map, size_t &classes);
+
+private:
+    /* true once a state ending the walk is reached */
+    template <typename T>
+    bool walk(const T *table, const uint8_t *str, size_t len, size_t &state) const;
+
+private:
+    template <typename T>
+    bool run(const T *table, const uint8_t *str, size_t len, size_t state, Budget *budget) const;
+
+private:
+    template <typename T>
+    void mapChunk(const T *table, const uint8_t *str, size_t len, uint32_t *map) const;
+
+private:
+    template <typename T>
+    bool runParallel(const T *table, const uint8_t *str, size_t len, size_t state, size_t threads) const;
+
+private:
+    template <typename T>
+    void runBatch(const T *table, const char *const *strs, const size_t *lens, size_t count, bool *results) const;
+
+public:
+    /* explores every state of the lazy DFA, fails if the program is not supported or does not fit in `budget` bytes */
+    bool build(const Program &program, size_t budget = MaxTableSize);
+
+public:
+    size_t states(void) const { return _accepts.size(); }
+    size_t classes(void) const { return _classes; }
+
+public:
+    /* whether the program matches anywhere at or after `start`, only valid once built. bytes walked are spent
+     * from `budget` if given, false once it's exceeded */
+    bool exec(const char *str, size_t len, size_t start, Budget *budget = nullptr) const;
+
+public:
+    /* `exec` on every input from it's beginning, `DFA::Lanes` inputs are interleaved so their table lookups overlap */
+    void execBatch(const char *const *strs, const size_t *lens, size_t count, bool *results) const;
+
+public:
+    /* `exec` on `threads` threads (every hardware thread if 0) for large inputs. the input is split into chunks,
+     * the first one is walked as usual and the others from every state at once, then their end states are
+     * composed in order */
+    bool execParallel(const char *str, size_t len, size_t start, size_t threads = 0) const;
+
+};
+}
+
+#endif /* FASTREGEXP_DENSEDFA_H */
@@ -0,0 +1,70 @@
+#ifndef FASTREGEXP_FRAGMENTS_H
+#define FASTREGEXP_FRAGMENTS_H
+
+#include <list>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "Program.h"
+
+namespace FastRegExp
+{
+/* compiled sub-patterns keyed by the structure of their syntax trees, so pieces repeated across a rule base are
+ * compiled only once. it saves compile time only, every program still gets it's own copy of the instructions. meant
+ * to be shared by every compiler of a set, from any number of threads */
+class Fragments
+{
+public:
+    struct Fragment
+    {
+        size_t registers = 0;
+        std::vector<ByteSet> sets;
+        std::vector<Literal> literals;
+        std::vector<std::vector<size_t>> sequences;
+        std::vector<Instruction> code;      /* addresses count from the first instruction */
+    };
+
+private:
+    struct Entry
+    {
+        std::shared_ptr<const Fragment> fragment;
+        std::list<const std::string *>::iterator use;
+    };
+
+private:
+    size_t _hits = 0;
+    size_t _limit;
+    mutable std::mutex _mutex;
+    std::list<const std::string *> _uses;       /* keys from the most to the least recently used */
+    std::unordered_map<std::string, Entry> _fragments;
+
+public:
+    /* default number of fragments kept, the least recently used one is dropped to make room for a new one */
+    static const size_t Limit = 4096;
+
+public:
+    explicit Fragments(size_t limit = Limit);
+
+public:
+    Fragments(const Fragments &) = delete;
+    Fragments &operator=(const Fragments &) = delete;
+
+public:
+    size_t size(void) const;
+    size_t hits(void) const;
+
+public:
+    void clear(void);
+
+public:
+    /* null if no fragment has `key` */
+    std::shared_ptr<const Fragment> find(const std::string &key);
+    void insert(std::string &&key, std::shared_ptr<const Fragment> fragment);
+
+};
+}
+
+#endif /* FASTREGEXP_FRAGMENTS_H */
@@ -0,0 +1,45 @@
+#ifndef FASTREGEXP_PAGES_H
+#define FASTREGEXP_PAGES_H
+
+#include <cstddef>
+#include <sys/types.h>
+
+namespace FastRegExp
+{
+namespace Pages
+{
+enum class Policy : int
+{
+    PolicyNormal,           /* pages of the default size */
+    PolicyTransparent,      /* transparent huge pages, asked for with `madvise` */
+    PolicyExplicit,         /* huge pages reserved by the administrator, transparent ones when none are left */
+};
+
+/* memory mapped with huge pages is rounded up to, and aligned on, this size */
+static const size_t HugePageSize = 2 * 1024 * 1024;
+
+/* the policy for memory mapped from now on. the `FASTREGEXP_PAGES` environment variable (`normal`,
+ * `transparent` or `explicit`) sets the one at startup */
+Policy policy(void);
+void setPolicy(Policy policy);
+
+/* name of a policy, as accepted by `FASTREGEXP_PAGES` */
+const char *nameOf(Policy policy);
+
+/* NUMA nodes of the system, 1 if unknown */
+size_t nodes(void);
+
+/* the node the calling thread ran on when it first asked, threads are expected to stay pinned to it */
+size_t currentNode(void);
+
+/* maps `size` bytes of zeroed read-write memory with `policy`, falling back to smaller pages when huge ones can't
+ * be had, and prefers the memory of `node` unless it's -1. null on failure, `mapped` receives the size to unmap */
+void *map(size_t size, Policy policy, ssize_t node, size_t &mapped);
+void unmap(void *addr, size_t mapped);
+
+/* asks for transparent huge pages on memory already mapped, false if they are not available */
+bool advise(void *addr, size_t size);
+}
+}
+
+#endif /* FASTREGEXP_PAGES_H */
@@ -3,6 +3,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 #include <unordered_map>
 
 #include "AST.h"
@@ -13,7 +14,20 @@ namespace FastRegExp
 {
 class Parser
 {
+    struct Frame
+    {
+        char32_t delim;
+        int flags;                                  /* flags to restore when the group ends */
+        std::shared_ptr<AST::Elementry> owner;      /* element holding the group, null for the outermost expression */
+        std::shared_ptr<AST::RegExp> regexp;
+        std::shared_ptr<AST::Section> section;
+        std::u32string name;
+    };
+
+private:
     size_t _pos;
+    int _flags;
+    int _options;
     std::u32string _regexp;
 
 private:
@@ -21,10 +35,12 @@ private:
     std::unordered_map<std::u32string, std::shared_ptr<AST::RegExp>> _namedGroups;
 
 public:
-    explicit Parser(const std::string &regexp) : _pos(0), _regexp(Unicode::toUnicode(regexp)) {}
+    explicit Parser(const std::string &regexp, int flags = 0) :
+        _pos(0), _flags(flags), _options(flags), _regexp(Unicode::toUnicode(regexp)) {}
 
 private:
     size_t parseInt(void);
+    void skipExtended(void);
 
 private:
     static inline bool isDigit(char32_t ch) noexcept { return ch >= U'0' && ch <= U'9'; }
@@ -47,18 +63,25 @@ private:
 
 private:
     std::shared_ptr<AST::RegExp     > parseRegExp   (char32_t delim);
-    std::shared_ptr<AST::Section    > parseSection  (char32_t delim);
-    std::shared_ptr<AST::Elementry  > parseElementry(void);
-
-private:
     std::shared_ptr<AST::Range      > parseRange    (void);
-    std::shared_ptr<AST::SubExpr    > parseSubExpr  (void);
     std::shared_ptr<AST::Character  > parseCharacter(void);
 
+private:
+    void parseModifier(AST::Elementry &result);
+    bool parseSubExpr (AST::SubExpr &result, int &flags, std::u32string &name);
+    void closeSubExpr (AST::SubExpr &result, int flags, std::u32string &name);
+
+public:
+    const std::vector<std::shared_ptr<AST::RegExp>> &groups(void) const { return _groups; }
+    const std::unordered_map<std::u32string, std::shared_ptr<AST::RegExp>> &namedGroups(void) const { return _namedGroups; }
+
 public:
     std::shared_ptr<AST::Node> parse(void)
     {
+        _pos = 0;
+        _flags = _options;
         _groups.clear();
+        _namedGroups.clear();
         return parseRegExp(U'|');
     }
 };
@@ -0,0 +1,169 @@
+#ifndef FASTREGEXP_PROGRAM_H
+#define FASTREGEXP_PROGRAM_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+#include <sys/types.h>
+
+#include "ByteSet.h"
+#include "Scanner.h"
+
+namespace FastRegExp
+{
+struct Literal
+{
+    std::string bytes;
+    std::string masks;      /* bits ignored when comparing, 0x20 for case-insensitive ASCII letters */
+
+public:
+    /* branch-free so the comparison can be vectorized */
+    inline bool matches(const uint8_t *str) const
+    {
+        uint8_t diff = 0;
+        const uint8_t *m = reinterpret_cast<const uint8_t *>(masks.data());
+        const uint8_t *b = reinterpret_cast<const uint8_t *>(bytes.data());
+
+        for (size_t i = 0; i < bytes.size(); i++)
+            diff |= (str[i] | m[i]) ^ b[i];
+
+        return diff == 0;
+    }
+};
+
+struct Instruction
+{
+    enum class Opcode : int
+    {
+        OpcodeSet,              /* match one byte in `sets[index]` */
+        OpcodeByte,             /* match one byte equals to `index` */
+        OpcodeJump,             /* continue at `x` */
+        OpcodeMark,             /* `registers[index]` = current position */
+        OpcodeSave,             /* `slots[index]` = current position */
+        OpcodeMatch,            /* successful match */
+        OpcodeSplit,            /* try `x`, then `y` on failure */
+        OpcodeAssert,           /* zero-width assertion of kind `index` */
+        OpcodeBackref,          /* match the text captured by group `index` */
+        OpcodeLiteral,          /* match the string `literals[index]` */
+        OpcodeLookEnd,          /* end of a look-around body, look-behinds must end at `registers[index]` */
+        OpcodeLookSets,         /* fixed-width look-around, bytes at the offset must match `sequences[index]` */
+        OpcodeLookLiteral,      /* fixed-width look-around, bytes at the offset must equal to `literals[index]` */
+        OpcodeLookaround,       /* look-around with it's body at `x` and continues at `y`, look-behinds start
+                                 * `lower` to `upper` bytes before the current position */
+        OpcodeProgress,         /* continue at `x` if nothing consumed since `Mark` of `registers[index]`, and
+                                 * counter `registers[y - 1]` (if `y` is not 0) has reached `lower` */
+        OpcodeRepeatSet,        /* consume `lower` to `upper` bytes in `sets[index]` in a single loop, only
+                                 * stopping between UTF-8 characters if `isWhole` */
+        OpcodeCounterInit,      /* `registers[index]` = 0 */
+        OpcodeCounterIncr,      /* `registers[index]` += 1 */
+        OpcodeCounterLoop,      /* body at `x`, exit at `y`, iterations counted in `registers[index]` */
+    };
+
+public:
+    enum class Assertion : int
+    {
+        AssertionWordBorder,
+        AssertionNonWordBorder,
+        AssertionEndOfLine,
+        AssertionStartOfLine,
+        AssertionEndOfString,
+        AssertionStartOfString,
+    };
+
+public:
+    Opcode opcode;
+    size_t index = 0;
+    bool isBehind = false;
+    bool isNegative = false;
+    bool isCaseless = false;
+    bool isWhole = false;
+
+public:
+    size_t x = 0;
+    size_t y = 0;
+
+public:
+    bool isLazy = false;
+    size_t lower = 0;
+    ssize_t upper = -1;
+
+public:
+    explicit Instruction(Opcode opcode, size_t index = 0) : opcode(opcode), index(index) {}
+
+};
+
+/* where the references of instructions moved into another program end up, the offsets are negative when moving
+ * them out into a program of their own */
+struct Relocation
+{
+    ssize_t code = 0;
+    ssize_t literals = 0;
+    ssize_t sequences = 0;
+    ssize_t registers = 0;
+    std::vector<size_t> sets;       /* new index of each set */
+
+public:
+    void apply(Instruction &ins) const;
+    void apply(std::vector<size_t> &sequence) const;
+
+};
+
+/* properties of the pattern, found while compiling it */
+struct Analysis
+{
+    size_t minLength = 0;           /* in bytes */
+    ssize_t maxLength = -1;         /* in bytes, -1 if unbounded */
+
+public:
+    bool hasBackrefs = false;
+    bool hasLookarounds = false;
+
+public:
+    bool isAnchoredStart = false;   /* every alternative starts with '^', matches only start at the beginning */
+    bool isAnchoredEnd = false;     /* every alternative ends with '$', matches only end at the end */
+
+public:
+    ssize_t riskPos = -1;           /* loop whose iterations can split the same input in many ways, -1 if none */
+    std::string risk;
+    bool isMemoizable = false;      /* failures depend only on the instruction and position */
+
+public:
+    /* backtracking may take exponential time, even with memoization */
+    bool isRisky(void) const { return riskPos >= 0 && !isMemoizable; }
+
+};
+
+struct Program
+{
+    size_t groups = 0;
+    size_t registers = 0;
+    Analysis analysis;
+
+public:
+    std::unordered_map<std::string, size_t> names;      /* named groups and their indexes */
+
+public:
+    std::vector<ByteSet> sets;
+    std::vector<Scanner> scanners;      /* one for each set, skips runs of bytes within it */
+    std::vector<Literal> literals;
+    std::vector<std::vector<size_t>> sequences;
+    std::vector<Instruction> code;
+
+public:
+    std::string toString(void) const;
+
+public:
+    /* a program matching whatever any of `programs` matches. groups are shared, each alternative uses the
+     * numbers it had on it's own, so the captures only make sense knowing which one matched */
+    static Program alternate(const std::vector<const Program *> &programs);
+
+public:
+    /* a program matching what `program` matches only from the beginning of input, and only up to it's end
+     * if `isFull` */
+    static Program anchor(const Program &program, bool isFull);
+
+};
+}
+
+#endif /* FASTREGEXP_PROGRAM_H */
@@ -0,0 +1,166 @@
+#ifndef FASTREGEXP_REGEXP_H
+#define FASTREGEXP_REGEXP_H
+
+#include <mutex>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <sys/types.h>
+
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+
+#include "AST.h"
+#include "Budget.h"
+#include "Program.h"
+#include "DenseDFA.h"
+#include "Fragments.h"
+#include "Substitution.h"
+
+namespace FastRegExp
+{
+struct Span
+{
+    ssize_t begin = -1;
+    ssize_t end = -1;
+
+public:
+    bool isSet(void) const { return begin >= 0; }
+    size_t size(void) const { return isSet() ? static_cast<size_t>(end - begin) : 0; }
+
+#if __cplusplus >= 201703L
+public:
+    std::string_view view(const char *str) const { return isSet() ? std::string_view(str + begin, size()) : std::string_view(); }
+#endif
+};
+
+class RegExp
+{
+    /* the pattern anchored for `matchPrefix` or `fullMatch`, built on first use and shared between copies */
+    struct Anchored
+    {
+        std::once_flag once;
+        Program program;
+        std::shared_ptr<DenseDFA> dense;
+    };
+
+private:
+    bool _useDFA;
+    Program _program;
+    std::shared_ptr<DenseDFA> _dense;      /* shared between copies, it's never modified once built */
+
+private:
+    std::shared_ptr<Anchored> _prefix;     /* null if the pattern is anchored at the start on it's own */
+    std::shared_ptr<Anchored> _full;       /* null if the pattern is anchored at both ends on it's own */
+
+public:
+    /* sub-patterns already in `fragments` are not compiled again, and the new ones are added to it */
+    explicit RegExp(const std::string &regexp, int flags = 0, Fragments *fragments = nullptr);
+
+public:
+    size_t groups(void) const { return _program.groups; }
+    const Program &program(void) const { return _program; }
+    const Analysis &analysis(void) const { return _program.analysis; }
+
+public:
+    /* compiles a replacement template against the groups of this pattern */
+    Substitution substitution(const std::string &format) const { return Substitution(format, _program); }
+
+private:
+    bool mayMatch(DFA &dfa, const char *str, size_t len, size_t start, Budget *budget) const;
+    bool mayMatch(DFA &dfa, const DenseDFA *dense, const char *str, size_t len, size_t start, Budget *budget) const;
+
+private:
+    Budget::Result match(const char *str, size_t len, size_t start, std::vector<ssize_t> *slots, Budget *budget) const;
+    Budget::Result match(const Program &program, const DenseDFA *dense, const char *str, size_t len, size_t start, std::vector<ssize_t> *slots, Budget *budget) const;
+
+private:
+    bool matchAnchored(const std::string &str, std::vector<ssize_t> *slots, bool isFull) const;
+
+private:
+    template <typename Callback>
+    size_t each(const char *str, size_t len, size_t limit, Budget *budget, Callback &&callback) const;
+
+private:
+    template <typename String>
+    void batch(const String *strs, size_t count, uint64_t *out) const;
+
+public:
+    /* whether the pattern matches anywhere in `str`, or `ResultExceeded` if `budget` ran out before knowing */
+    bool test(const std::string &str) const;
+    Budget::Result test(const std::string &str, Budget &budget) const;
+
+public:
+    /* whether a match starts at the beginning of `str`, `slots` as for `search` */
+    bool matchPrefix(const std::string &str) const { return matchAnchored(str, nullptr, false); }
+    bool matchPrefix(const std::string &str, std::vector<ssize_t> &slots) const { return matchAnchored(str, &slots, false); }
+
+public:
+    /* whether the whole of `str` matches, the captures in `slots` are the ones of the first match in priority
+     * order that spans all of it. the automaton stops at the first byte no such match can go through */
+    bool fullMatch(const std::string &str) const { return matchAnchored(str, nullptr, true); }
+    bool fullMatch(const std::string &str, std::vector<ssize_t> &slots) const { return matchAnchored(str, &slots, true); }
+
+public:
+    /* `test` on `threads` threads (every hardware thread if 0), for inputs large enough to be split into chunks.
+     * only patterns with an automaton built ahead of time run in parallel, the others as `test` */
+    bool testParallel(const char *str, size_t len, size_t threads = 0) const;
+    bool testParallel(const std::string &str, size_t threads = 0) const { return testParallel(str.data(), str.size(), threads); }
+
+public:
+    /* `test` on `count` inputs, bit `i % 64` of `out[i / 64]` is set if input `i` matches. inputs are walked
+     * interleaved through the DFA to hide the latency of it's table lookups */
+    void matchBatch(const std::string *strs, size_t count, uint64_t *out) const;
+
+#if __cplusplus >= 201703L
+public:
+    void matchBatch(const std::string_view *strs, size_t count, uint64_t *out) const;
+#endif
+
+public:
+    /* leftmost match at or after `start`, `slots` receives begin and end offsets of every group, -1 if not participated.
+     * `slots` is left untouched unless the result is `ResultMatch` */
+    bool search(const std::string &str, std::vector<ssize_t> &slots, size_t start = 0) const;
+    Budget::Result search(const std::string &str, std::vector<ssize_t> &slots, Budget &budget, size_t start = 0) const;
+
+public:
+    /* every non-overlapping match, at most `limit` of them if not 0. `spans` is cleared and receives `groups() + 1`
+     * spans per match, so a buffer reused across calls stops allocating. after an empty match only a non-empty one
+     * may start at the same position, as with Python's `re` since 3.7. returns the number of matches, the ones found
+     * before `budget` was exceeded if given */
+    size_t findIter(const char *str, size_t len, std::vector<Span> &spans, size_t limit = 0, Budget *budget = nullptr) const;
+    size_t findIter(const std::string &str, std::vector<Span> &spans, size_t limit = 0, Budget *budget = nullptr) const
+    {
+        return findIter(str.data(), str.size(), spans, limit, budget);
+    }
+
+public:
+    /* the pieces between matches, splitting at most `limit` times if not 0, returns the number of pieces. the last
+     * piece is the rest of `str` after the matches found, also when `budget` is exceeded */
+    size_t split(const char *str, size_t len, std::vector<Span> &pieces, size_t limit = 0, Budget *budget = nullptr) const;
+    size_t split(const std::string &str, std::vector<Span> &pieces, size_t limit = 0, Budget *budget = nullptr) const
+    {
+        return split(str.data(), str.size(), pieces, limit, budget);
+    }
+
+public:
+    /* `out` is overwritten with `str` where matches are replaced, at most `limit` of them if not 0. returns the
+     * number of replacements, only the matches found before `budget` was exceeded are replaced */
+    size_t replace(const char *str, size_t len, const Substitution &substitution, std::string &out, size_t limit = 0, Budget *budget = nullptr) const;
+    size_t replace(const std::string &str, const Substitution &substitution, std::string &out, size_t limit = 0, Budget *budget = nullptr) const
+    {
+        return replace(str.data(), str.size(), substitution, out, limit, budget);
+    }
+
+public:
+    size_t replace(const std::string &str, const std::string &format, std::string &out, size_t limit = 0, Budget *budget = nullptr) const
+    {
+        return replace(str.data(), str.size(), substitution(format), out, limit, budget);
+    }
+
+};
+}
+
+#endif /* FASTREGEXP_REGEXP_H */
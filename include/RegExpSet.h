@@ -0,0 +1,100 @@
+#ifndef FASTREGEXP_REGEXPSET_H
+#define FASTREGEXP_REGEXPSET_H
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "RegExp.h"
+#include "Program.h"
+#include "DenseDFA.h"
+#include "Fragments.h"
+
+namespace FastRegExp
+{
+/* a set of patterns telling which of them match, split into shards of a bounded size. changes rebuild only the
+ * shards they touch and publish a new snapshot at once, matching works on whatever snapshot was current when
+ * it started and never waits for a change */
+class RegExpSet
+{
+    struct Shard
+    {
+        std::vector<size_t> ids;
+        std::vector<std::shared_ptr<const RegExp>> patterns;
+
+    public:
+        Program program;                        /* alternation of the patterns in `united` */
+        std::shared_ptr<DenseDFA> dense;        /* null if too large to build ahead of time */
+        std::vector<size_t> united;             /* patterns the DFA supports, tried one by one only if `program` matches */
+        std::vector<size_t> others;             /* patterns always tried one by one */
+
+    };
+
+private:
+    struct Snapshot
+    {
+        size_t size = 0;
+        std::vector<std::shared_ptr<const Shard>> shards;
+    };
+
+private:
+    size_t _next = 0;
+    size_t _shardSize;
+    std::mutex _mutex;                          /* held by changes only */
+    Fragments _fragments;                       /* sub-patterns of everything added so far */
+
+#if defined(__cpp_lib_atomic_shared_ptr)
+private:
+    std::atomic<std::shared_ptr<const Snapshot>> _snapshot;
+#else
+private:
+    std::shared_ptr<const Snapshot> _snapshot;  /* only accessed with `std::atomic_load` and `std::atomic_store` */
+#endif
+
+public:
+    /* default number of patterns in a shard */
+    static const size_t ShardSize = 64;
+
+public:
+    explicit RegExpSet(size_t shardSize = ShardSize);
+
+public:
+    RegExpSet(const RegExpSet &) = delete;
+    RegExpSet &operator=(const RegExpSet &) = delete;
+
+private:
+    std::shared_ptr<const Snapshot> load(void) const;
+    static bool united(const Shard &shard, const std::string &str);
+    static std::shared_ptr<const Shard> build(std::vector<size_t> &&ids, std::vector<std::shared_ptr<const RegExp>> &&patterns);
+
+private:
+    void update(std::vector<std::shared_ptr<const RegExp>> &&added, const std::vector<size_t> &removed, std::vector<size_t> &ids, size_t &count);
+
+public:
+    size_t size(void) const { return load()->size; }
+    size_t shards(void) const { return load()->shards.size(); }
+
+public:
+    /* compiles and adds the patterns, returning their ids. nothing is added if any of them throws `SyntaxError` */
+    size_t add(const std::string &pattern, int flags = 0);
+    std::vector<size_t> add(const std::vector<std::string> &patterns, int flags = 0);
+
+public:
+    /* returns the number of patterns removed, unknown ids are ignored */
+    size_t remove(size_t id) { return remove(std::vector<size_t>(1, id)); }
+    size_t remove(const std::vector<size_t> &ids);
+
+public:
+    /* whether any of the patterns matches anywhere in `str` */
+    bool test(const std::string &str) const;
+
+public:
+    /* `ids` is cleared and receives the ids of every pattern matching anywhere in `str`, in ascending order */
+    void match(const std::string &str, std::vector<size_t> &ids) const;
+
+};
+}
+
+#endif /* FASTREGEXP_REGEXPSET_H */
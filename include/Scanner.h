@@ -0,0 +1,64 @@
+#ifndef FASTREGEXP_SCANNER_H
+#define FASTREGEXP_SCANNER_H
+
+#include <cstdint>
+#include <cstddef>
+
+#include "CPU.h"
+#include "ByteSet.h"
+
+namespace FastRegExp
+{
+/* measures runs of bytes within a set, 16 to 64 bytes at a time when the set has a vectorizable shape. the kernels
+ * are selected from `CPU::tier()` when constructed */
+class Scanner
+{
+    enum class Type : int
+    {
+        ScannerAll,             /* every byte */
+        ScannerScalar,          /* one byte at a time */
+        ScannerRange,           /* bytes from `_bytes[0]` to `_bytes[1]` */
+        ScannerExcept,          /* every byte except the first `_count` of `_bytes` */
+        ScannerTable,           /* any set, with nibble lookup tables */
+    };
+
+private:
+    Type _type;
+    CPU::Tier _tier;
+    ByteSet _set;
+    size_t _count = 0;
+    uint8_t _bytes[4] = {};
+
+private:
+    alignas(16) uint8_t _lower[16] = {};    /* bit `hi` of `_lower[lo]` is set for byte `hi << 4 | lo`, `hi` < 8 */
+    alignas(16) uint8_t _upper[16] = {};    /* the same for `hi` >= 8 */
+
+public:
+    explicit Scanner(const ByteSet &set);
+
+public:
+    CPU::Tier tier(void) const { return _tier; }
+
+private:
+    size_t spanRange(const uint8_t *str, size_t len) const;
+    size_t spanExcept(const uint8_t *str, size_t len) const;
+    size_t spanTable(const uint8_t *str, size_t len) const;
+
+private:
+    size_t spanRange256(const uint8_t *str, size_t len) const;
+    size_t spanExcept256(const uint8_t *str, size_t len) const;
+    size_t spanTable256(const uint8_t *str, size_t len) const;
+
+private:
+    size_t spanRange512(const uint8_t *str, size_t len) const;
+    size_t spanExcept512(const uint8_t *str, size_t len) const;
+    size_t spanTable512(const uint8_t *str, size_t len) const;
+
+public:
+    /* number of leading bytes of `str` in the set, at most `len` */
+    size_t span(const uint8_t *str, size_t len) const;
+
+};
+}
+
+#endif /* FASTREGEXP_SCANNER_H */
@@ -0,0 +1,1072 @@
+#ifndef FASTREGEXP_STATICREGEXP_H
+#define FASTREGEXP_STATICREGEXP_H
+
+#if __cplusplus < 202002L
+#error "StaticRegExp.h requires C++20, configure with -DFAST_REG_EXP_CXX_STANDARD=20"
+#endif
+
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <string_view>
+
+namespace FastRegExp
+{
+namespace Static
+{
+static constexpr size_t npos = static_cast<size_t>(-1);
+
+/* bytes of the well-formed UTF-8 character starting at `p`, 0 if there is none. these are the sequences the
+ * runtime compiler accepts, without overlong forms or surrogates */
+constexpr size_t lengthOf(const char *p, const char *end)
+{
+    size_t size;
+    uint8_t lower = 0x80;
+    uint8_t upper = 0xbf;
+    uint8_t lead = static_cast<uint8_t>(*p);
+
+    if (lead < 0x80)
+        return 1;
+    else if (lead < 0xc2)
+        return 0;
+    else if (lead < 0xe0)
+        size = 2;
+    else if (lead < 0xf0)
+        size = 3;
+    else if (lead < 0xf5)
+        size = 4;
+    else
+        return 0;
+
+    /* the second byte has a narrower range after some leads */
+    switch (lead)
+    {
+        case 0xe0: lower = 0xa0; break;
+        case 0xed: upper = 0x9f; break;
+        case 0xf0: lower = 0x90; break;
+        case 0xf4: upper = 0x8f; break;
+    }
+
+    if (static_cast<size_t>(end - p) < size)
+        return 0;
+
+    for (size_t i = 1; i < size; i++)
+    {
+        uint8_t ch = static_cast<uint8_t>(p[i]);
+
+        if (ch < (i == 1 ? lower : 0x80) || ch > (i == 1 ? upper : 0xbf))
+            return 0;
+    }
+
+    return size;
+}
+
+template <size_t N>
+struct Pattern
+{
+    char data[N] = {};
+
+public:
+    constexpr Pattern(const char (&str)[N])
+    {
+        for (size_t i = 0; i < N; i++)
+            data[i] = str[i];
+    }
+
+public:
+    constexpr size_t length(void) const { return N - 1; }
+
+};
+
+struct Set
+{
+    uint64_t bits[4] = {};
+
+public:
+    constexpr void add(uint8_t ch) { bits[ch >> 6] |= 1ull << (ch & 63); }
+    constexpr bool test(uint8_t ch) const { return (bits[ch >> 6] >> (ch & 63)) & 1; }
+
+public:
+    /* only inverted sets have bytes above ASCII, they take every non-ASCII character */
+    constexpr bool isWide(void) const { return bits[2] || bits[3]; }
+
+public:
+    constexpr void add(const Set &other)
+    {
+        for (size_t i = 0; i < 4; i++)
+            bits[i] |= other.bits[i];
+    }
+
+public:
+    constexpr void invert(void)
+    {
+        for (size_t i = 0; i < 4; i++)
+            bits[i] = ~bits[i];
+    }
+
+public:
+    constexpr void addRange(uint8_t lower, uint8_t upper)
+    {
+        for (unsigned int ch = lower; ch <= upper; ch++)
+            add(static_cast<uint8_t>(ch));
+    }
+};
+
+struct Node
+{
+    enum class Type : int
+    {
+        NodeSet,
+        NodeGroup,
+        NodeCharacter,
+        NodeBranch,
+        NodeRepeat,
+        NodeBorder,
+        NodeNonBorder,
+        NodeAlternation,
+        NodeEndOfString,
+        NodeStartOfString,
+    };
+
+public:
+    Type type = Type::NodeSet;
+    Set set;
+
+public:
+    char bytes[4] = {};     /* UTF-8 encoding of a `NodeCharacter` */
+    size_t length = 0;
+
+public:
+    size_t next = npos;     /* next node of the same sequence */
+    size_t child = npos;    /* group body, repeated element, first branch, or first node of a branch */
+    size_t sibling = npos;  /* next branch of the same alternation */
+
+public:
+    size_t index = npos;    /* capture group index, `npos` for non-capture groups */
+    size_t lower = 0;
+    size_t upper = npos;
+    bool isLazy = false;
+
+};
+
+/* every character of the pattern produces at most 2 nodes */
+template <size_t N>
+struct Tree
+{
+    Node nodes[N * 2 + 4];
+    size_t count = 0;
+    size_t groups = 0;
+
+};
+
+/* constexpr counterpart of `Parser`, failures are reported by throwing which
+ * makes the evaluation non-constant, thus turns into a compile error */
+template <size_t N>
+class Parser
+{
+    size_t _pos = 0;
+    const Pattern<N> &_regexp;
+
+public:
+    Tree<N> tree;
+
+public:
+    constexpr explicit Parser(const Pattern<N> &regexp) : _regexp(regexp) {}
+
+private:
+    constexpr char peek(void) const { return _pos < _regexp.length() ? _regexp.data[_pos  ] : 0; }
+    constexpr char next(void)       { return _pos < _regexp.length() ? _regexp.data[_pos++] : 0; }
+
+private:
+    constexpr bool skipIf(char ch)
+    {
+        if (peek() != ch)
+            return false;
+
+        next();
+        return true;
+    }
+
+private:
+    constexpr size_t create(Node::Type type)
+    {
+        tree.nodes[tree.count].type = type;
+        return tree.count++;
+    }
+
+private:
+    static constexpr bool isDigit(char ch) { return ch >= '0' && ch <= '9'; }
+
+private:
+    static constexpr Set wordSet(void)
+    {
+        Set set;
+        set.add('_');
+        set.addRange('0', '9');
+        set.addRange('a', 'z');
+        set.addRange('A', 'Z');
+        return set;
+    }
+
+private:
+    static constexpr Set spaceSet(void)
+    {
+        Set set;
+        set.addRange('\t', '\r');
+        set.add(' ');
+        return set;
+    }
+
+private:
+    static constexpr Set digitSet(void)
+    {
+        Set set;
+        set.addRange('0', '9');
+        return set;
+    }
+
+private:
+    constexpr size_t parseInt(void)
+    {
+        size_t x = 0;
+
+        if (!isDigit(peek()))
+            throw "invalid digit";
+
+        while (isDigit(peek()))
+        {
+            x *= 10;
+            x += next() - '0';
+        }
+
+        return x;
+    }
+
+private:
+    constexpr size_t parseRegExp(void)
+    {
+        size_t last = npos;
+        size_t result = create(Node::Type::NodeAlternation);
+
+        for (;;)
+        {
+            size_t branch = create(Node::Type::NodeBranch);
+            tree.nodes[branch].child = parseSection();
+
+            /* chain the branches */
+            if (last == npos)
+                tree.nodes[result].child = branch;
+            else
+                tree.nodes[last].sibling = branch;
+
+            /* splitted by '|' */
+            last = branch;
+
+            if (!skipIf('|'))
+                return result;
+        }
+    }
+
+private:
+    constexpr size_t parseSection(void)
+    {
+        size_t last = npos;
+        size_t first = npos;
+
+        while (peek() != 0 && peek() != '|' && peek() != ')')
+        {
+            size_t node = parseElementry();
+
+            if (last == npos)
+                first = node;
+            else
+                tree.nodes[last].next = node;
+
+            last = node;
+        }
+
+        return first;
+    }
+
+private:
+    constexpr size_t parseElementry(void)
+    {
+        size_t result;
+
+        switch (peek())
+        {
+            case '^': { next(); result = create(Node::Type::NodeStartOfString); break; }
+            case '$': { next(); result = create(Node::Type::NodeEndOfString  ); break; }
+
+            case '.':
+            {
+                next();
+                result = create(Node::Type::NodeSet);
+                tree.nodes[result].set.add('\n');
+                tree.nodes[result].set.invert();
+                break;
+            }
+
+            case '[':
+            {
+                result = parseRange();
+                break;
+            }
+
+            case '(':
+            {
+                result = parseSubExpr();
+                break;
+            }
+
+            case '\\':
+            {
+                switch (_regexp.data[_pos + 1])
+                {
+                    case 'b': { _pos += 2; result = create(Node::Type::NodeBorder   ); break; }
+                    case 'B': { _pos += 2; result = create(Node::Type::NodeNonBorder); break; }
+
+                    default:
+                    {
+                        result = parseLiteral();
+                        break;
+                    }
+                }
+
+                break;
+            }
+
+            default:
+            {
+                result = parseLiteral();
+                break;
+            }
+        }
+
+        size_t lower = 0;
+        size_t upper = npos;
+
+        switch (peek())
+        {
+            case '+': { next(); lower = 1; break; }
+            case '*': { next(); lower = 0; break; }
+            case '?': { next(); upper = 1; break; }
+
+            case '{':
+            {
+                next();
+                lower = parseInt();
+
+                if (!skipIf(','))
+                    upper = lower;
+                else if (peek() != '}')
+                    upper = parseInt();
+
+                if (next() != '}')
+                    throw "'}' expected";
+
+                if (upper < lower)
+                    throw "invalid repeat range";
+
+                break;
+            }
+
+            default:
+                return result;
+        }
+
+        size_t repeat = create(Node::Type::NodeRepeat);
+        tree.nodes[repeat].child = result;
+        tree.nodes[repeat].lower = lower;
+        tree.nodes[repeat].upper = upper;
+        tree.nodes[repeat].isLazy = skipIf('?');
+        return repeat;
+    }
+
+private:
+    constexpr size_t parseRange(void)
+    {
+        bool isInverted;
+        size_t result = create(Node::Type::NodeSet);
+
+        if (next() != '[')
+            throw "'[' expected";
+
+        isInverted = skipIf('^');
+
+        do
+        {
+            Set lower = parseCharacter(true);
+
+            if (!skipIf('-'))
+            {
+                /* single character */
+                tree.nodes[result].set.add(lower);
+            }
+            else if (peek() == ']')
+            {
+                /* 2 discrete characters */
+                tree.nodes[result].set.add(lower);
+                tree.nodes[result].set.add('-');
+            }
+            else
+            {
+                Set upper = parseCharacter(true);
+                unsigned int lo = 256;
+                unsigned int hi = 256;
+
+                for (unsigned int ch = 0; ch < 256; ch++)
+                {
+                    if (lower.test(static_cast<uint8_t>(ch))) lo = (lo == 256) ? ch : 257;
+                    if (upper.test(static_cast<uint8_t>(ch))) hi = (hi == 256) ? ch : 257;
+                }
+
+                if (lo > 255 || hi > 255 || lo > hi)
+                    throw "invalid character range";
+
+                tree.nodes[result].set.addRange(static_cast<uint8_t>(lo), static_cast<uint8_t>(hi));
+            }
+        } while (peek() != ']' && peek() != 0);
+
+        if (next() != ']')
+            throw "']' expected";
+
+        if (isInverted)
+            tree.nodes[result].set.invert();
+
+        return result;
+    }
+
+private:
+    constexpr size_t parseSubExpr(void)
+    {
+        size_t result = create(Node::Type::NodeGroup);
+
+        if (next() != '(')
+            throw "'(' expected";
+
+        if (!skipIf('?'))
+        {
+            tree.nodes[result].child = parseRegExp();
+            tree.nodes[result].index = ++tree.groups;
+        }
+        else
+        {
+            switch (next())
+            {
+                case ':':
+                {
+                    tree.nodes[result].child = parseRegExp();
+                    break;
+                }
+
+                case 'P':
+                {
+                    if (next() != '<')
+                        throw "only `(?P<name>...)` is supported by static regular expressions";
+
+                    while (peek() != '>')
+                        if (next() == 0)
+                            throw "'>' expected";
+
+                    next();
+                    tree.nodes[result].child = parseRegExp();
+                    tree.nodes[result].index = ++tree.groups;
+                    break;
+                }
+
+                default:
+                    throw "look-arounds and group references are not supported by static regular expressions";
+            }
+        }
+
+        if (next() != ')')
+            throw "')' expected";
+
+        return result;
+    }
+
+private:
+    constexpr uint8_t parseHex(int count)
+    {
+        uint8_t result = 0;
+
+        for (int i = 0; i < count; i++)
+        {
+            char ch = next();
+
+            if (ch >= '0' && ch <= '9')
+                result = result * 16 + (ch - '0');
+            else if (ch >= 'a' && ch <= 'f')
+                result = result * 16 + (ch - 'a' + 10);
+            else if (ch >= 'A' && ch <= 'F')
+                result = result * 16 + (ch - 'A' + 10);
+            else
+                throw "invalid hexadecimal character";
+        }
+
+        return result;
+    }
+
+private:
+    constexpr Set parseCharacter(bool inRange)
+    {
+        Set result;
+        char ch = next();
+
+        if (ch == 0)
+            throw "\"EOF\" when parsing characters";
+
+        if (inRange && (static_cast<uint8_t>(ch) & 0x80))
+            throw "non-ASCII characters inside ranges are not supported by static regular expressions";
+
+        if (ch != '\\')
+        {
+            result.add(static_cast<uint8_t>(ch));
+            return result;
+        }
+
+        switch ((ch = next()))
+        {
+            case 0:
+                throw "\"EOF\" when parsing escape sequence";
+
+            case 'b':
+            case 'B':
+                throw "word borders are not allowed inside ranges";
+
+            case 'w': { result = wordSet();  break; }
+            case 'd': { result = digitSet(); break; }
+            case 's': { result = spaceSet(); break; }
+
+            case 'W': { result = wordSet();  result.invert(); break; }
+            case 'D': { result = digitSet(); result.invert(); break; }
+            case 'S': { result = spaceSet(); result.invert(); break; }
+
+            case 'n': { result.add('\n'); break; }
+            case 'r': { result.add('\r'); break; }
+            case 't': { result.add('\t'); break; }
+            case 'f': { result.add('\f'); break; }
+            case 'v': { result.add('\v'); break; }
+            case 'x':
+            {
+                uint8_t value = parseHex(2);
+
+                if (value & 0x80)
+                    throw "non-ASCII characters inside ranges are not supported by static regular expressions";
+
+                result.add(value);
+                break;
+            }
+
+            case 'c':
+            {
+                if (peek() >= 'a' && peek() <= 'z')
+                    result.add(static_cast<uint8_t>(next() - 'a' + 1));
+                else if (peek() >= 'A' && peek() <= 'Z')
+                    result.add(static_cast<uint8_t>(next() - 'A' + 1));
+                else
+                    result.add('c');
+
+                break;
+            }
+
+            case '0':
+            {
+                uint8_t value = 0;
+
+                for (int i = 0; (i < 2) && (peek() >= '0' && peek() <= '7'); i++)
+                    value = value * 8 + (next() - '0');
+
+                result.add(value);
+                break;
+            }
+
+            default:
+            {
+                if (ch >= '1' && ch <= '9')
+                    throw "back-references are not supported by static regular expressions";
+
+                result.add(static_cast<uint8_t>(ch));
+                break;
+            }
+        }
+
+        return result;
+    }
+
+private:
+    /* a character outside of ranges, non-ASCII ones are matched as a whole by their UTF-8 sequence */
+    constexpr size_t parseLiteral(void)
+    {
+        size_t pos = _pos;
+        size_t result = create(Node::Type::NodeSet);
+        Node &node = tree.nodes[result];
+
+        if (static_cast<uint8_t>(peek()) & 0x80)
+        {
+            node.type = Node::Type::NodeCharacter;
+            node.length = lengthOf(_regexp.data + _pos, _regexp.data + _regexp.length());
+
+            if (node.length == 0)
+                throw "invalid UTF-8 sequence";
+
+            for (size_t i = 0; i < node.length; i++)
+                node.bytes[i] = next();
+
+            return result;
+        }
+
+        /* `\xHH` is a code point, as it is for `Parser` */
+        if (peek() == '\\' && _regexp.data[_pos + 1] == 'x')
+        {
+            _pos += 2;
+            uint8_t ch = parseHex(2);
+
+            if (ch & 0x80)
+            {
+                node.type = Node::Type::NodeCharacter;
+                node.bytes[0] = static_cast<char>(0xc0 | (ch >> 6));
+                node.bytes[1] = static_cast<char>(0x80 | (ch & 0x3f));
+                node.length = 2;
+                return result;
+            }
+
+            _pos = pos;
+        }
+
+        node.set = parseCharacter(false);
+        return result;
+    }
+
+public:
+    constexpr void parse(void)
+    {
+        parseRegExp();
+
+        if (_pos != _regexp.length())
+            throw "unbalanced ')'";
+    }
+};
+
+template <size_t N>
+constexpr Tree<N> parse(const Pattern<N> &regexp)
+{
+    Parser<N> parser(regexp);
+    parser.parse();
+    return parser.tree;
+}
+}
+
+/* Regular expression that is parsed at compile time, and matched by
+ * fully inlined code generated from the pattern itself, for example:
+ *
+ *     using Version = FastRegExp::StaticRegExp<R"(HTTP/(\d)\.(\d))">;
+ *     Version::Groups groups;
+ *
+ *     if (Version::match("HTTP/1.1", groups))
+ *         ...
+ *
+ * Matching is done on UTF-8 characters as `RegExp` does, and groups are numbered the same way as `Parser` does.
+ * Classes and escapes are ASCII only, but '.' and negated ones take every non-ASCII character as a whole. */
+template <Static::Pattern P>
+class StaticRegExp
+{
+    static constexpr auto _tree = Static::parse(P);
+
+public:
+    using Groups = std::array<std::string_view, _tree.groups + 1>;
+
+private:
+    struct Context
+    {
+        const char *begin;
+        const char *end;
+        std::string_view *groups;
+    };
+
+private:
+    static constexpr bool isWord(char ch)
+    {
+        return (ch >= 'a' && ch <= 'z') ||
+               (ch >= 'A' && ch <= 'Z') ||
+               (ch >= '0' && ch <= '9') ||
+               (ch == '_');
+    }
+
+private:
+    static inline bool isBorder(const Context &ctx, const char *p)
+    {
+        bool prev = (p != ctx.begin) && isWord(p[-1]);
+        bool next = (p != ctx.end) && isWord(p[0]);
+        return prev != next;
+    }
+
+private:
+    static inline bool isContinuation(const char *p)
+    {
+        return (static_cast<uint8_t>(*p) & 0xc0) == 0x80;
+    }
+
+private:
+    /* bytes of the character at `p` if it's in `set`, 0 otherwise */
+    static inline size_t widthOf(const Context &ctx, const Static::Set &set, const char *p)
+    {
+        if (p == ctx.end || !set.test(static_cast<uint8_t>(*p)))
+            return 0;
+        else if (static_cast<uint8_t>(*p) < 0x80)
+            return 1;
+        else
+            return Static::lengthOf(p, ctx.end);
+    }
+
+private:
+    template <size_t I, typename K>
+    static inline bool matchSequence(Context &ctx, const char *p, K &&k)
+    {
+        if constexpr (I == Static::npos)
+            return k(p);
+        else
+            return matchNode<I>(ctx, p, [&](const char *q) { return matchSequence<_tree.nodes[I].next>(ctx, q, k); });
+    }
+
+private:
+    template <size_t I, typename K>
+    static inline bool matchBranches(Context &ctx, const char *p, K &&k)
+    {
+        if constexpr (I == Static::npos)
+            return false;
+        else if (matchSequence<_tree.nodes[I].child>(ctx, p, k))
+            return true;
+        else
+            return matchBranches<_tree.nodes[I].sibling>(ctx, p, k);
+    }
+
+private:
+    /* end of the `n`-th way, in priority order, node `I` matches at `p`, null if there are fewer. the groups are
+     * left as that way captured them */
+    template <size_t I>
+    static const char *matchNth(Context &ctx, const char *p, size_t n)
+    {
+        const char *result = nullptr;
+
+        matchNode<I>(ctx, p, [&](const char *q)
+        {
+            if (n-- != 0)
+                return false;
+
+            result = q;
+            return true;
+        });
+
+        return result;
+    }
+
+private:
+    template <size_t I, typename K>
+    static bool matchRepeat(Context &ctx, const char *p, K &k)
+    {
+        constexpr Static::Node node = _tree.nodes[I];
+
+        /* one frame per iteration, so long inputs don't nest a continuation for each one. an iteration resumes
+         * it's body by asking for the next way it matches, with the groups as they were before it started */
+        struct Frame
+        {
+            const char *p;
+            size_t way;
+            Groups groups;
+        };
+
+        std::vector<Frame> stack;
+        Groups groups;
+
+        std::copy_n(ctx.groups, groups.size(), groups.begin());
+
+        if constexpr (node.isLazy)
+            if (node.lower == 0 && k(p))
+                return true;
+
+        stack.push_back({ p, 0, groups });
+
+        while (!stack.empty())
+        {
+            size_t count = stack.size() - 1;
+            const char *q = nullptr;
+            const char *start = stack.back().p;
+
+            std::copy_n(stack.back().groups.begin(), groups.size(), ctx.groups);
+
+            if (count < node.upper)
+                q = matchNth<node.child>(ctx, start, stack.back().way++);
+
+            if (q == nullptr)
+            {
+                stack.pop_back();
+
+                /* every way of the next iteration failed, so the greedy one stops before it */
+                if constexpr (!node.isLazy)
+                    if (count >= node.lower && k(start))
+                        return true;
+            }
+            else if (q == start)
+            {
+                /* an empty iteration satisfies all the remaining iterations */
+                if (k(q))
+                    return true;
+            }
+            else
+            {
+                /* the lazy one stops as soon as it may */
+                if constexpr (node.isLazy)
+                    if (count + 1 >= node.lower && k(q))
+                        return true;
+
+                std::copy_n(ctx.groups, groups.size(), groups.begin());
+                stack.push_back({ q, 0, groups });
+            }
+        }
+
+        return false;
+    }
+
+private:
+    template <size_t I, typename K>
+    static inline bool matchNode(Context &ctx, const char *p, K &&k)
+    {
+        constexpr Static::Node node = _tree.nodes[I];
+
+        if constexpr (node.type == Static::Node::Type::NodeSet && !node.set.isWide())
+        {
+            return (p != ctx.end) && node.set.test(static_cast<uint8_t>(*p)) && k(p + 1);
+        }
+        else if constexpr (node.type == Static::Node::Type::NodeSet)
+        {
+            size_t width = widthOf(ctx, node.set, p);
+            return width && k(p + width);
+        }
+        else if constexpr (node.type == Static::Node::Type::NodeCharacter)
+        {
+            if (static_cast<size_t>(ctx.end - p) < node.length)
+                return false;
+
+            for (size_t i = 0; i < node.length; i++)
+                if (p[i] != node.bytes[i])
+                    return false;
+
+            return k(p + node.length);
+        }
+        else if constexpr (node.type == Static::Node::Type::NodeBorder)
+        {
+            return isBorder(ctx, p) && k(p);
+        }
+        else if constexpr (node.type == Static::Node::Type::NodeNonBorder)
+        {
+            return !isBorder(ctx, p) && k(p);
+        }
+        else if constexpr (node.type == Static::Node::Type::NodeEndOfString)
+        {
+            return (p == ctx.end) && k(p);
+        }
+        else if constexpr (node.type == Static::Node::Type::NodeStartOfString)
+        {
+            return (p == ctx.begin) && k(p);
+        }
+        else if constexpr (node.type == Static::Node::Type::NodeAlternation)
+        {
+            return matchBranches<node.child>(ctx, p, k);
+        }
+        else if constexpr (node.type == Static::Node::Type::NodeGroup)
+        {
+            if constexpr (node.index == Static::npos)
+            {
+                return matchNode<node.child>(ctx, p, k);
+            }
+            else
+            {
+                return matchNode<node.child>(ctx, p, [&](const char *q)
+                {
+                    std::string_view saved = ctx.groups[node.index];
+                    ctx.groups[node.index] = std::string_view(p, q - p);
+
+                    /* restore the group on failure */
+                    if (k(q))
+                        return true;
+
+                    ctx.groups[node.index] = saved;
+                    return false;
+                });
+            }
+        }
+        else if constexpr (node.type == Static::Node::Type::NodeRepeat &&
+                           _tree.nodes[node.child].type == Static::Node::Type::NodeSet &&
+                           _tree.nodes[node.child].set.isWide())
+        {
+            /* the same over whole characters, stepping back over the continuation bytes */
+            constexpr Static::Set set = _tree.nodes[node.child].set;
+            const char *q = p;
+            size_t n = 0;
+
+            if constexpr (node.isLazy)
+            {
+                for (; n < node.lower; n++)
+                {
+                    size_t width = widthOf(ctx, set, q);
+
+                    if (width == 0)
+                        return false;
+
+                    q += width;
+                }
+
+                for (;; n++)
+                {
+                    size_t width;
+
+                    if (k(q))
+                        return true;
+
+                    if (n >= node.upper || (width = widthOf(ctx, set, q)) == 0)
+                        return false;
+
+                    q += width;
+                }
+            }
+            else
+            {
+                for (size_t width; n < node.upper && (width = widthOf(ctx, set, q)) != 0; n++)
+                    q += width;
+
+                for (;; n--)
+                {
+                    if (n < node.lower)
+                        return false;
+
+                    if (k(q))
+                        return true;
+
+                    if (n == 0)
+                        return false;
+
+                    do
+                        q--;
+                    while (isContinuation(q));
+                }
+            }
+        }
+        else if constexpr (node.type == Static::Node::Type::NodeRepeat &&
+                           _tree.nodes[node.child].type == Static::Node::Type::NodeSet)
+        {
+            /* single character loops, count the run and then backtrack without recursion */
+            constexpr Static::Set set = _tree.nodes[node.child].set;
+            size_t limit = static_cast<size_t>(ctx.end - p);
+
+            if constexpr (node.upper != Static::npos)
+                if (limit > node.upper)
+                    limit = node.upper;
+
+            if constexpr (node.isLazy)
+            {
+                for (size_t n = 0; n < node.lower; n++)
+                    if (n >= limit || !set.test(static_cast<uint8_t>(p[n])))
+                        return false;
+
+                for (size_t n = node.lower;; n++)
+                {
+                    if (k(p + n))
+                        return true;
+
+                    if (n >= limit || !set.test(static_cast<uint8_t>(p[n])))
+                        return false;
+                }
+            }
+            else
+            {
+                size_t n = 0;
+
+                while (n < limit && set.test(static_cast<uint8_t>(p[n])))
+                    n++;
+
+                for (; n >= node.lower && n != Static::npos; n--)
+                    if (k(p + n))
+                        return true;
+
+                return false;
+            }
+        }
+        else if constexpr (node.type == Static::Node::Type::NodeRepeat)
+        {
+            return matchRepeat<I>(ctx, p, k);
+        }
+        else
+        {
+            static_assert(I != I, "unknown node type");
+            return false;
+        }
+    }
+
+public:
+    static constexpr size_t groups(void) { return _tree.groups; }
+
+public:
+    static bool match(std::string_view str, Groups &groups)
+    {
+        Context ctx = { str.data(), str.data() + str.size(), groups.data() };
+        groups.fill(std::string_view());
+
+        /* the whole string must be consumed */
+        return matchNode<0>(ctx, ctx.begin, [&](const char *q)
+        {
+            if (q != ctx.end)
+                return false;
+
+            groups[0] = str;
+            return true;
+        });
+    }
+
+public:
+    static bool search(std::string_view str, Groups &groups)
+    {
+        Context ctx = { str.data(), str.data() + str.size(), groups.data() };
+        groups.fill(std::string_view());
+
+        /* leftmost match, with the usual backtracking priorities */
+        for (const char *p = ctx.begin;; p++)
+        {
+            /* matches don't start inside a character */
+            if (p != ctx.end && isContinuation(p))
+                continue;
+
+            bool found = matchNode<0>(ctx, p, [&](const char *q)
+            {
+                groups[0] = std::string_view(p, q - p);
+                return true;
+            });
+
+            if (found)
+                return true;
+
+            if (p == ctx.end)
+                return false;
+        }
+    }
+
+public:
+    static bool match(std::string_view str)
+    {
+        Groups groups;
+        return match(str, groups);
+    }
+
+public:
+    static bool search(std::string_view str)
+    {
+        Groups groups;
+        return search(str, groups);
+    }
+};
+}
+
+#endif /* FASTREGEXP_STATICREGEXP_H */
@@ -0,0 +1,41 @@
+#ifndef FASTREGEXP_SUBSTITUTION_H
+#define FASTREGEXP_SUBSTITUTION_H
+
+#include <string>
+#include <vector>
+#include <sys/types.h>
+
+#include "Program.h"
+#include "SyntaxError.h"
+
+namespace FastRegExp
+{
+/* replacement template, `$n`, `${n}` and `${name}` refer to groups, `$$` is a literal dollar sign */
+class Substitution
+{
+    struct Part
+    {
+        ssize_t group;          /* -1 for literal text */
+        size_t begin;
+        size_t end;
+    };
+
+private:
+    std::string _format;
+    std::vector<Part> _parts;
+
+public:
+    explicit Substitution(const std::string &format, const Program &program);
+
+private:
+    void addText(size_t begin, size_t end);
+    size_t parseGroup(size_t begin, size_t &pos, size_t end, size_t groups) const;
+
+public:
+    /* appends the expansion to `out`, unset groups expand to nothing */
+    void expand(const char *str, const std::vector<ssize_t> &slots, std::string &out) const;
+
+};
+}
+
+#endif /* FASTREGEXP_SUBSTITUTION_H */
@@ -0,0 +1,134 @@
+#ifndef FASTREGEXP_TABLEALLOCATOR_H
+#define FASTREGEXP_TABLEALLOCATOR_H
+
+#include <map>
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+#include "Pages.h"
+
+namespace FastRegExp
+{
+class TableAllocator;
+
+/* a read-only table, given back to it's allocator when destroyed. replicated tables have a copy on every NUMA
+ * node, and each thread reads the one on it's own node */
+class Table
+{
+    size_t _size;
+    size_t _offset;
+    std::vector<const uint8_t *> _copies;
+
+private:
+    void *_chunk;
+    TableAllocator *_allocator;
+
+private:
+    friend class TableAllocator;
+    explicit Table(TableAllocator *allocator, void *chunk, size_t offset, std::vector<const uint8_t *> copies, size_t size) :
+        _size(size), _offset(offset), _copies(std::move(copies)), _chunk(chunk), _allocator(allocator) {}
+
+public:
+    ~Table();
+    Table(const Table &) = delete;
+    Table &operator=(const Table &) = delete;
+
+public:
+    size_t size(void) const { return _size; }
+    size_t copies(void) const { return _copies.size(); }
+
+public:
+    const void *data(void) const
+    {
+        if (_copies.size() == 1)
+            return _copies.front();
+        else
+            return _copies[Pages::currentNode() % _copies.size()];
+    }
+
+};
+
+/* packs read-only tables into shared chunks, mapped with the page policy in effect when they are created so large
+ * sets of patterns take few TLB entries. with the default policy and no replication the tables are just allocated
+ * on the heap, and not counted in the usage */
+class TableAllocator
+{
+    struct Copy
+    {
+        uint8_t *data;
+        size_t mapped;                      /* rounded up to it's pages, which may differ between nodes */
+    };
+
+private:
+    struct Chunk
+    {
+        size_t size;
+        size_t used;
+        bool isShared;                      /* false for tables mapped on their own */
+        std::vector<Copy> copies;           /* one for each node if replicated */
+        std::map<size_t, size_t> free;      /* offset to size of free blocks, merged with their neighbours */
+    };
+
+public:
+    struct Usage
+    {
+        size_t used = 0;                    /* bytes of tables, rounded to `Alignment`, for every copy */
+        size_t mapped = 0;                  /* bytes of memory mapped for them */
+        size_t chunks = 0;
+        size_t tables = 0;
+    };
+
+private:
+    Usage _usage;
+    bool _isReplicated = false;
+    std::mutex _mutex;
+    std::vector<std::unique_ptr<Chunk>> _chunks;
+
+public:
+    /* tables start on cache lines */
+    static const size_t Alignment = 64;
+
+public:
+    /* chunks are mapped this size, tables above half of it get chunks of their own */
+    static const size_t ChunkSize = Pages::HugePageSize;
+
+public:
+    explicit TableAllocator();
+    ~TableAllocator();
+
+public:
+    TableAllocator(const TableAllocator &) = delete;
+    TableAllocator &operator=(const TableAllocator &) = delete;
+
+public:
+    /* the allocator used by compiled patterns, never destroyed so tables may outlive static destructors */
+    static TableAllocator &instance(void);
+
+public:
+    /* whether tables allocated from now on are copied to every NUMA node, the `FASTREGEXP_REPLICATE` environment
+     * variable set to 1 turns it on at startup. does nothing on a single node */
+    bool isReplicated(void);
+    void setReplicated(bool isReplicated);
+
+private:
+    Chunk *map(size_t size, bool isShared);
+    void unmap(Chunk &chunk);
+
+private:
+    friend class Table;
+    void release(void *chunk, size_t offset, size_t size);
+
+public:
+    /* copies `size` bytes of `data` into a table, throws `std::bad_alloc` if it can't be allocated */
+    std::shared_ptr<Table> allocate(const void *data, size_t size);
+
+public:
+    Usage usage(void);
+
+};
+}
+
+#endif /* FASTREGEXP_TABLEALLOCATOR_H */
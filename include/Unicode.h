@@ -3,7 +3,9 @@
 
 #include <locale>
 #include <string>
+#include <vector>
 #include <codecvt>
+#include <utility>
 
 namespace FastRegExp
 {
@@ -45,6 +47,16 @@ static inline std::u32string toUnicode(const T &v)
         char32_t
     >().from_bytes(v);
 }
+
+/* the next character in the simple case folding orbit of `ch`, or `ch` itself if it's caseless */
+char32_t simpleFold(char32_t ch);
+
+/* appends every case variant of the characters within `ranges`, as single character ranges */
+void foldRanges(std::vector<std::pair<char32_t, char32_t>> &ranges);
+
+/* appends the ranges of the general category or script called `name`, false if there is none. names are matched
+ * loosely, ignoring case, spaces, '-' and '_', and may be qualified as in `gc=Lu` or `Script=Greek` */
+bool propertyRanges(const std::u32string &name, std::vector<std::pair<char32_t, char32_t>> &ranges);
 }
 }
 
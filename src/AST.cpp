@@ -25,10 +25,44 @@ static inline std::string header(size_t count)
     return result;
 }
 
+template <typename T>
+static inline void append(std::string &key, T value)
+{
+    key.append(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+static inline void append(std::string &key, const std::u32string &name)
+{
+    append(key, name.size());
+    key.append(reinterpret_cast<const char *>(name.data()), name.size() * sizeof(char32_t));
+}
+
 namespace FastRegExp
 {
 namespace AST
 {
+static void detach(RegExp &node, std::vector<std::shared_ptr<RegExp>> &children)
+{
+    for (const auto &section : node.sections)
+        if (section.use_count() == 1)
+            for (const auto &element : section->elements)
+                if (element.use_count() == 1 && element->subexpr && element->subexpr.use_count() == 1 && element->subexpr->expr.use_count() == 1)
+                    children.push_back(std::move(element->subexpr->expr));
+}
+
+RegExp::~RegExp()
+{
+    std::vector<std::shared_ptr<RegExp>> children;
+
+    /* nested groups are released one at a time instead of recursively, so depth is not limited by the call stack */
+    for (detach(*this, children); !children.empty(); )
+    {
+        std::shared_ptr<RegExp> child = std::move(children.back());
+        children.pop_back();
+        detach(*child, children);
+    }
+}
+
 std::string RegExp::toString(size_t level) const noexcept
 {
     std::string result = header(level) + "RegExp\n";
@@ -36,6 +70,13 @@ std::string RegExp::toString(size_t level) const noexcept
     return result;
 }
 
+bool RegExp::appendKey(std::string &key) const noexcept
+{
+    append(key, 'R');
+    append(key, sections.size());
+    return std::all_of(sections.begin(), sections.end(), [&](auto x){ return x->appendKey(key); });
+}
+
 std::string Section::toString(size_t level) const noexcept
 {
     std::string result = header(level) + "Section\n";
@@ -43,6 +84,13 @@ std::string Section::toString(size_t level) const noexcept
     return result;
 }
 
+bool Section::appendKey(std::string &key) const noexcept
+{
+    append(key, 'S');
+    append(key, elements.size());
+    return std::all_of(elements.begin(), elements.end(), [&](auto x){ return x->appendKey(key); });
+}
+
 std::string Elementry::toString(size_t level) const noexcept
 {
     std::string result = header(level) + "Elementry\n";
@@ -87,9 +135,46 @@ std::string Elementry::toString(size_t level) const noexcept
         }
     }
 
+    if (flags)
+    {
+        result += header(level + 1) + "Flags";
+        result += (flags & Flags::FlagIgnoreCase) ? " i" : "";
+        result += (flags & Flags::FlagMultiLine ) ? " m" : "";
+        result += (flags & Flags::FlagDotAll    ) ? " s" : "";
+        result += (flags & Flags::FlagExtended  ) ? " x" : "";
+        result += "\n";
+    }
+
     return result;
 }
 
+bool Elementry::appendKey(std::string &key) const noexcept
+{
+    append(key, 'E');
+    append(key, type);
+    append(key, modifier.type);
+
+    /* the other flags only matter while parsing */
+    append(key, flags & (Flags::FlagDotAll | Flags::FlagMultiLine | Flags::FlagIgnoreCase));
+
+    if (modifier.type != Modifier::Type::ModifierNone)
+    {
+        append(key, modifier.isLazy);
+        append(key, modifier.lower);
+        append(key, modifier.upper);
+    }
+
+    switch (type)
+    {
+        case Type::ElementryRange     : return range->appendKey(key);
+        case Type::ElementrySubExpr   : return subexpr->appendKey(key);
+        case Type::ElementryCharacter : return character->appendKey(key);
+
+        default:
+            return true;
+    }
+}
+
 std::string Range::toString(size_t level) const noexcept
 {
     std::string result = header(level)
@@ -121,6 +206,23 @@ std::string Range::toString(size_t level) const noexcept
     return result;
 }
 
+bool Range::appendKey(std::string &key) const noexcept
+{
+    append(key, 'C');
+    append(key, isInverted);
+    append(key, items.size());
+
+    for (const auto &range : items)
+    {
+        append(key, range.second != nullptr);
+
+        if (!range.first->appendKey(key) || (range.second && !range.second->appendKey(key)))
+            return false;
+    }
+
+    return true;
+}
+
 std::string SubExpr::toString(size_t level) const noexcept
 {
     std::string result = header(level) + "Sub-expression\n";
@@ -148,6 +250,23 @@ std::string SubExpr::toString(size_t level) const noexcept
     return result;
 }
 
+bool SubExpr::appendKey(std::string &key) const noexcept
+{
+    append(key, 'G');
+    append(key, type);
+
+    switch (type)
+    {
+        /* captures and references are numbered within the whole pattern */
+        case Type::SubExprSimple    : return false;
+        case Type::SubExprReference : return false;
+        case Type::SubExprMatchName : return false;
+
+        default:
+            return expr->appendKey(key);
+    }
+}
+
 std::string Character::toString(size_t level) const noexcept
 {
     std::string result = header(level);
@@ -164,6 +283,15 @@ std::string Character::toString(size_t level) const noexcept
         case Type::CharacterNonSpace  : result += "Non-Space\n" ; break;
         case Type::CharacterNonBorder : result += "Non-Border\n"; break;
 
+        case Type::CharacterProperty:
+        case Type::CharacterNonProperty:
+        {
+            result += type == Type::CharacterProperty ? "Property '" : "Non-Property '";
+            result += Unicode::toString(name);
+            result += "'\n";
+            break;
+        }
+
         case Type::CharacterSimple:
         {
             result += "Simple '";
@@ -210,4 +338,25 @@ std::string Character::toString(size_t level) const noexcept
 
     return result;
 }
+
+bool Character::appendKey(std::string &key) const noexcept
+{
+    append(key, 'c');
+    append(key, type);
+
+    switch (type)
+    {
+        case Type::CharacterSimple      : append(key, character); return true;
+        case Type::CharacterControl     : append(key, character); return true;
+        case Type::CharacterProperty    : append(key, name); return true;
+        case Type::CharacterNonProperty : append(key, name); return true;
+
+        case Type::CharacterReference   : return false;
+        case Type::CharacterMatchName   : return false;
+        case Type::CharacterMatchIndex  : return false;
+
+        default:
+            return true;
+    }
+}
 }}
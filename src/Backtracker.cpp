@@ -0,0 +1,497 @@
+#include <cstring>
+#include <algorithm>
+
+#include "Backtracker.h"
+
+namespace FastRegExp
+{
+/* the position of the next character at or after `pos` */
+static inline size_t toBoundary(const uint8_t *str, size_t len, size_t pos)
+{
+    while (pos < len && Backtracker::isContinuation(str[pos]))
+        pos++;
+
+    return pos;
+}
+
+bool Backtracker::checkAssertion(const uint8_t *str, size_t len, size_t pos, Instruction::Assertion assertion) const
+{
+    switch (assertion)
+    {
+        case Instruction::Assertion::AssertionEndOfString   : return pos == len;
+        case Instruction::Assertion::AssertionStartOfString : return pos == 0;
+        case Instruction::Assertion::AssertionEndOfLine     : return pos == len || str[pos] == '\n';
+        case Instruction::Assertion::AssertionStartOfLine   : return pos == 0 || str[pos - 1] == '\n';
+
+        case Instruction::Assertion::AssertionWordBorder:
+        case Instruction::Assertion::AssertionNonWordBorder:
+        {
+            bool prev = (pos > 0) && isWord(str[pos - 1]);
+            bool next = (pos < len) && isWord(str[pos]);
+            return (prev != next) == (assertion == Instruction::Assertion::AssertionWordBorder);
+        }
+    }
+
+    return false;
+}
+
+bool Backtracker::lookFixed(const uint8_t *str, size_t len, size_t pos, const Instruction &ins) const
+{
+    size_t width;
+    const uint8_t *ptr;
+
+    /* bytes are compared in place, without touching the backtracking stack */
+    if (ins.opcode == Instruction::Opcode::OpcodeLookLiteral)
+        width = _program.literals[ins.index].bytes.size();
+    else
+        width = _program.sequences[ins.index].size();
+
+    if (ins.isBehind)
+    {
+        if (pos < width)
+            return false;
+        else
+            ptr = str + pos - width;
+    }
+    else
+    {
+        if (len - pos < width)
+            return false;
+        else
+            ptr = str + pos;
+    }
+
+    if (ins.opcode == Instruction::Opcode::OpcodeLookLiteral)
+        return _program.literals[ins.index].matches(ptr);
+
+    for (size_t i = 0; i < width; i++)
+        if (!_program.sets[_program.sequences[ins.index][i]].test(ptr[i]))
+            return false;
+
+    return true;
+}
+
+bool Backtracker::lookaround(const uint8_t *str, size_t len, size_t pos, const Instruction &ins)
+{
+    size_t base = _stack.size();
+
+    /* the body runs on top of the current stack, and never backtracks below it */
+    if (!run(str, len, ins.x, pos, base))
+        return false;
+
+    /* negative look-arounds keep nothing from the body */
+    if (ins.isNegative)
+    {
+        while (_stack.size() > base)
+        {
+            const Frame &frame = _stack.back();
+
+            switch (frame.type)
+            {
+                case Frame::Type::FrameRestoreSlot     : _slots[frame.pos] = frame.value; break;
+                case Frame::Type::FrameRestoreRegister : _registers[frame.pos] = frame.value; break;
+                default                                : break;
+            }
+
+            _stack.pop_back();
+        }
+
+        return true;
+    }
+
+    /* positive look-arounds keep the captures, but are atomic */
+    auto it = std::remove_if(_stack.begin() + base, _stack.end(), [](const Frame &frame)
+    {
+        return frame.type != Frame::Type::FrameRestoreSlot &&
+               frame.type != Frame::Type::FrameRestoreRegister;
+    });
+
+    _stack.erase(it, _stack.end());
+    return true;
+}
+
+bool Backtracker::run(const uint8_t *str, size_t len, size_t pc, size_t pos, size_t base)
+{
+    const Instruction *code = _program.code.data();
+    const ByteSet *sets = _program.sets.data();
+
+    for (;;)
+    {
+        const Instruction &ins = code[pc];
+
+        /* reaching a state again means it failed before, the first visit would have matched otherwise */
+        if (!_visited.empty())
+        {
+            size_t state = pos * _program.code.size() + pc;
+
+            if (_visited[state])
+                goto fail;
+
+            _visited[state] = true;
+        }
+
+        switch (ins.opcode)
+        {
+            case Instruction::Opcode::OpcodeSet:
+            {
+                if (pos >= len || !sets[ins.index].test(str[pos]))
+                    goto fail;
+
+                pc++;
+                pos++;
+                continue;
+            }
+
+            case Instruction::Opcode::OpcodeByte:
+            {
+                if (pos >= len || str[pos] != ins.index)
+                    goto fail;
+
+                pc++;
+                pos++;
+                continue;
+            }
+
+            case Instruction::Opcode::OpcodeJump:
+            {
+                /* backward jumps close loops */
+                if (ins.x < pc && _budget && !_budget->spend())
+                    return false;
+
+                pc = ins.x;
+                continue;
+            }
+
+            case Instruction::Opcode::OpcodeMark:
+            {
+                _stack.push_back({ Frame::Type::FrameRestoreRegister, 0, ins.index, _registers[ins.index] });
+                _registers[ins.index] = pos;
+                pc++;
+                continue;
+            }
+
+            case Instruction::Opcode::OpcodeSave:
+            {
+                _stack.push_back({ Frame::Type::FrameRestoreSlot, 0, ins.index, _slots[ins.index] });
+                _slots[ins.index] = pos;
+                pc++;
+                continue;
+            }
+
+            /* matches starting later end later, so only an empty one can end here */
+            case Instruction::Opcode::OpcodeMatch:
+            {
+                if (pos == _empty)
+                    goto fail;
+
+                return true;
+            }
+
+            case Instruction::Opcode::OpcodeSplit:
+            {
+                _stack.push_back({ Frame::Type::FrameBranch, ins.y, pos, 0 });
+                pc = ins.x;
+                continue;
+            }
+
+            case Instruction::Opcode::OpcodeAssert:
+            {
+                if (!checkAssertion(str, len, pos, static_cast<Instruction::Assertion>(ins.index)))
+                    goto fail;
+
+                pc++;
+                continue;
+            }
+
+            case Instruction::Opcode::OpcodeBackref:
+            {
+                ssize_t begin = _slots[ins.index * 2];
+                ssize_t end = _slots[ins.index * 2 + 1];
+
+                /* unset groups never match */
+                if (begin < 0 || end < begin)
+                    goto fail;
+
+                if (len - pos < static_cast<size_t>(end - begin))
+                    goto fail;
+
+                /* case-insensitive back-references only fold ASCII letters */
+                if (!ins.isCaseless)
+                {
+                    if (memcmp(str + pos, str + begin, end - begin))
+                        goto fail;
+                }
+                else
+                {
+                    for (ssize_t i = 0; i < end - begin; i++)
+                        if (str[pos + i] != str[begin + i] && (!isAlpha(str[pos + i]) || (str[pos + i] ^ 0x20) != str[begin + i]))
+                            goto fail;
+                }
+
+                pc++;
+                pos += end - begin;
+                continue;
+            }
+
+            case Instruction::Opcode::OpcodeLiteral:
+            {
+                const Literal &literal = _program.literals[ins.index];
+
+                if (len - pos < literal.bytes.size() || !literal.matches(str + pos))
+                    goto fail;
+
+                pc++;
+                pos += literal.bytes.size();
+                continue;
+            }
+
+            case Instruction::Opcode::OpcodeLookEnd:
+            {
+                if (ins.isBehind && _registers[ins.index] != static_cast<ssize_t>(pos))
+                    goto fail;
+
+                return true;
+            }
+
+            case Instruction::Opcode::OpcodeLookSets:
+            case Instruction::Opcode::OpcodeLookLiteral:
+            {
+                if (lookFixed(str, len, pos, ins) == ins.isNegative)
+                    goto fail;
+
+                pc++;
+                continue;
+            }
+
+            case Instruction::Opcode::OpcodeLookaround:
+            {
+                bool found = false;
+
+                if (!ins.isBehind)
+                {
+                    found = lookaround(str, len, pos, ins);
+                }
+                else
+                {
+                    size_t limit = std::min(pos, static_cast<size_t>(ins.upper));
+
+                    /* the body must end exactly where the look-behind is */
+                    _stack.push_back({ Frame::Type::FrameRestoreRegister, 0, ins.index, _registers[ins.index] });
+                    _registers[ins.index] = pos;
+
+                    for (size_t width = ins.lower; !found && width <= limit; width++)
+                        found = lookaround(str, len, pos - width, ins);
+                }
+
+                /* a body stopped by the budget neither matched nor failed */
+                if (_budget && _budget->isExceeded())
+                    return false;
+
+                if (found == ins.isNegative)
+                    goto fail;
+
+                pc = ins.y;
+                continue;
+            }
+
+            case Instruction::Opcode::OpcodeProgress:
+            {
+                /* counted loops only stop on empty iterations after `lower` iterations */
+                if (_registers[ins.index] != static_cast<ssize_t>(pos))
+                    pc++;
+                else if (ins.y && _registers[ins.y - 1] + 1 < static_cast<ssize_t>(ins.lower))
+                    pc++;
+                else
+                    pc = ins.x;
+
+                continue;
+            }
+
+            case Instruction::Opcode::OpcodeRepeatSet:
+            {
+                size_t count;
+                size_t limit = len - pos;
+                const Scanner &scanner = _program.scanners[ins.index];
+
+                if (ins.upper >= 0)
+                    limit = std::min(limit, static_cast<size_t>(ins.upper));
+
+                /* runs are measured in bulk by the scanner */
+                if (ins.isLazy)
+                {
+                    count = scanner.span(str + pos, std::min(limit, ins.lower));
+
+                    if (count < ins.lower)
+                        goto fail;
+
+                    /* the rest of the character comes along, it's bytes are all in the set */
+                    if (ins.isWhole)
+                        count = toBoundary(str, len, pos + count) - pos;
+
+                    if (count < limit)
+                        _stack.push_back({ Frame::Type::FrameLazyRepeat, pc, pos, static_cast<ssize_t>(count) });
+                }
+                else
+                {
+                    count = scanner.span(str + pos, limit);
+
+                    if (count < ins.lower)
+                        goto fail;
+
+                    if (count > ins.lower)
+                        _stack.push_back({ Frame::Type::FrameRepeat, pc, pos, static_cast<ssize_t>(count - 1) });
+                }
+
+                pc++;
+                pos += count;
+                continue;
+            }
+
+            case Instruction::Opcode::OpcodeCounterInit:
+            {
+                _stack.push_back({ Frame::Type::FrameRestoreRegister, 0, ins.index, _registers[ins.index] });
+                _registers[ins.index] = 0;
+                pc++;
+                continue;
+            }
+
+            case Instruction::Opcode::OpcodeCounterIncr:
+            {
+                _stack.push_back({ Frame::Type::FrameRestoreRegister, 0, ins.index, _registers[ins.index] });
+                _registers[ins.index]++;
+                pc++;
+                continue;
+            }
+
+            case Instruction::Opcode::OpcodeCounterLoop:
+            {
+                ssize_t count = _registers[ins.index];
+
+                if (count < static_cast<ssize_t>(ins.lower))
+                {
+                    pc = ins.x;
+                    continue;
+                }
+
+                if (ins.upper >= 0 && count >= ins.upper)
+                {
+                    pc = ins.y;
+                    continue;
+                }
+
+                _stack.push_back({ Frame::Type::FrameBranch, ins.isLazy ? ins.x : ins.y, pos, 0 });
+                pc = ins.isLazy ? ins.y : ins.x;
+                continue;
+            }
+        }
+
+    fail:
+        for (;;)
+        {
+            if (_stack.size() == base)
+                return false;
+
+            Frame frame = _stack.back();
+            _stack.pop_back();
+
+            switch (frame.type)
+            {
+                case Frame::Type::FrameRestoreSlot     : _slots[frame.pos] = frame.value; continue;
+                case Frame::Type::FrameRestoreRegister : _registers[frame.pos] = frame.value; continue;
+
+                case Frame::Type::FrameBranch:
+                {
+                    pc = frame.pc;
+                    pos = frame.pos;
+                    break;
+                }
+
+                /* give back one byte at a time, or one character for whole ones */
+                case Frame::Type::FrameRepeat:
+                {
+                    const Instruction &ins = code[frame.pc];
+                    ssize_t value = frame.value;
+
+                    while (ins.isWhole && static_cast<size_t>(value) > ins.lower && isContinuation(str[frame.pos + value]))
+                        value--;
+
+                    if (ins.isWhole && isContinuation(str[frame.pos + value]))
+                        continue;
+
+                    if (static_cast<size_t>(value) > ins.lower)
+                        _stack.push_back({ Frame::Type::FrameRepeat, frame.pc, frame.pos, value - 1 });
+
+                    pc = frame.pc + 1;
+                    pos = frame.pos + value;
+                    break;
+                }
+
+                /* take one more byte */
+                case Frame::Type::FrameLazyRepeat:
+                {
+                    const Instruction &ins = code[frame.pc];
+                    size_t next = frame.pos + frame.value;
+
+                    if (next >= len || !sets[ins.index].test(str[next]))
+                        continue;
+
+                    size_t end = ins.isWhole ? toBoundary(str, len, next + 1) : next + 1;
+
+                    if (ins.upper < 0 || static_cast<ssize_t>(end - frame.pos) < ins.upper)
+                        _stack.push_back({ Frame::Type::FrameLazyRepeat, frame.pc, frame.pos, static_cast<ssize_t>(end - frame.pos) });
+
+                    pc = frame.pc + 1;
+                    pos = end;
+                    break;
+                }
+            }
+
+            break;
+        }
+
+        /* every alternative taken is a step */
+        if (_budget && !_budget->spend())
+            return false;
+    }
+}
+
+bool Backtracker::exec(const char *str, size_t len, size_t start, bool resume, bool isNonEmpty)
+{
+    size_t width = _program.code.size();
+    const uint8_t *data = reinterpret_cast<const uint8_t *>(str);
+
+    /* only the states where the previous match ended were visited without failing */
+    if (!_memoize || width * (len + 1) > MaxVisited)
+        _visited.clear();
+    else if (!resume || _visited.size() != width * (len + 1))
+        _visited.assign(width * (len + 1), false);
+    else if (_stale <= len)
+        std::fill(_visited.begin() + _stale * width, _visited.begin() + (_stale + 1) * width, false);
+
+    _empty = isNonEmpty ? start : SIZE_MAX;
+
+    /* anchored patterns can only match where they are tried first */
+    size_t last = _program.analysis.isAnchoredStart ? std::min(start, len) : len;
+
+    for (size_t pos = start; pos <= last; pos++)
+    {
+        if (pos < len && isContinuation(data[pos]))
+            continue;
+
+        if (_budget && !_budget->spend())
+            return false;
+
+        _stack.clear();
+        std::fill(_slots.begin(), _slots.end(), -1);
+        std::fill(_registers.begin(), _registers.end(), 0);
+
+        if (run(data, len, 0, pos))
+        {
+            _stale = _slots[1];
+            return true;
+        }
+    }
+
+    return false;
+}
+}
@@ -0,0 +1,53 @@
+#include "Budget.h"
+
+namespace FastRegExp
+{
+void Budget::reset(void)
+{
+    _next = 0;
+    _steps = 0;
+    _states = 0;
+    _isExceeded = false;
+}
+
+bool Budget::check(void)
+{
+    if (_isExceeded)
+        return false;
+
+    if (steps && _steps > steps)
+        _isExceeded = true;
+    else if (cancel && cancel->load(std::memory_order_relaxed))
+        _isExceeded = true;
+    else if (deadline != Clock::time_point::max() && Clock::now() >= deadline)
+        _isExceeded = true;
+
+    /* an exceeded budget fails every call from now on */
+    if (_isExceeded)
+    {
+        _next = 0;
+        return false;
+    }
+
+    _next = _steps + Interval;
+
+    /* the step limit itself is exact */
+    if (steps && _next > steps)
+        _next = steps;
+
+    return true;
+}
+
+bool Budget::create(void)
+{
+    _states++;
+
+    if (states && _states > states)
+    {
+        _next = 0;
+        _isExceeded = true;
+    }
+
+    return !_isExceeded;
+}
+}
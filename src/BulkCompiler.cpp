@@ -0,0 +1,97 @@
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <exception>
+#include <system_error>
+#include <algorithm>
+
+#include "BulkCompiler.h"
+
+namespace FastRegExp
+{
+BulkCompiler::BulkCompiler(size_t threads) : _threads(threads)
+{
+    if (_threads == 0)
+        _threads = std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+std::vector<std::shared_ptr<RegExp>> BulkCompiler::compile(const std::vector<std::string> &patterns, int flags, std::vector<Error> &errors, Fragments *fragments) const
+{
+    std::mutex mutex;
+    std::atomic<size_t> next(0);
+    std::exception_ptr failure;
+    std::vector<std::thread> workers;
+    std::vector<std::shared_ptr<RegExp>> results(patterns.size());
+
+    size_t failed = patterns.size();
+    size_t count = std::min(_threads, (patterns.size() + Batch - 1) / Batch);
+
+    errors.clear();
+
+    /* each slot of `results` is written by exactly one thread, only errors need the lock */
+    auto worker = [&](void)
+    {
+        for (;;)
+        {
+            size_t begin = next.fetch_add(Batch);
+            size_t end = std::min(begin + Batch, patterns.size());
+
+            if (begin >= patterns.size())
+                return;
+
+            for (size_t i = begin; i < end; i++)
+            {
+                try
+                {
+                    results[i] = std::make_shared<RegExp>(patterns[i], flags, fragments);
+                }
+                catch (const SyntaxError &e)
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    errors.push_back({ i, e });
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+
+                    /* the first one in input order wins, like compiling serially would */
+                    if (i < failed)
+                    {
+                        failed = i;
+                        failure = std::current_exception();
+                    }
+                }
+            }
+        }
+    };
+
+    /* the calling thread is one of the workers */
+    for (size_t i = 1; i < count; i++)
+    {
+        /* running short of threads only makes it slower */
+        try
+        {
+            workers.emplace_back(worker);
+        }
+        catch (const std::system_error &)
+        {
+            break;
+        }
+    }
+
+    worker();
+
+    for (auto &thread : workers)
+        thread.join();
+
+    if (failure)
+        std::rethrow_exception(failure);
+
+    std::sort(errors.begin(), errors.end(), [](const Error &lhs, const Error &rhs)
+    {
+        return lhs.index < rhs.index;
+    });
+
+    return results;
+}
+}
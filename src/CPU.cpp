@@ -0,0 +1,111 @@
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+#include "CPU.h"
+
+namespace FastRegExp
+{
+namespace CPU
+{
+/* features a tier may use, BMI2 came along with AVX2 */
+static int maskOf(Tier tier)
+{
+    switch (tier)
+    {
+        case Tier::TierScalar : return 0;
+        case Tier::TierSSE2   : return FeatureSSE2;
+        case Tier::TierSSSE3  : return FeatureSSE2 | FeatureSSSE3;
+        case Tier::TierSSE42  : return FeatureSSE2 | FeatureSSSE3 | FeatureSSE42;
+        case Tier::TierAVX2   : return FeatureSSE2 | FeatureSSSE3 | FeatureSSE42 | FeatureAVX2 | FeatureBMI2;
+        default               : return FeatureSSE2 | FeatureSSSE3 | FeatureSSE42 | FeatureAVX2 | FeatureBMI2 | FeatureAVX512BW;
+    }
+}
+
+static int detect(void)
+{
+    int features = 0;
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    /* also checks the OS saves the wider registers */
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("sse2"))     features |= FeatureSSE2;
+    if (__builtin_cpu_supports("ssse3"))    features |= FeatureSSSE3;
+    if (__builtin_cpu_supports("sse4.2"))   features |= FeatureSSE42;
+    if (__builtin_cpu_supports("avx2"))     features |= FeatureAVX2;
+    if (__builtin_cpu_supports("avx512bw")) features |= FeatureAVX512BW;
+    if (__builtin_cpu_supports("bmi2"))     features |= FeatureBMI2;
+#endif
+
+    /* the override applies before anything gets to look at the features */
+    if (const char *name = getenv("FASTREGEXP_CPU"))
+    {
+        for (int i = static_cast<int>(Tier::TierScalar); i <= static_cast<int>(Tier::TierAVX512); i++)
+        {
+            if (!strcmp(name, nameOf(static_cast<Tier>(i))))
+            {
+                features &= maskOf(static_cast<Tier>(i));
+                break;
+            }
+        }
+    }
+
+    return features;
+}
+
+static std::atomic<int> &limited(void)
+{
+    static std::atomic<int> mask(maskOf(Tier::TierAVX512));
+    return mask;
+}
+
+int detected(void)
+{
+    static const int features = detect();
+    return features;
+}
+
+int features(void)
+{
+    return detected() & limited().load(std::memory_order_relaxed);
+}
+
+Tier tier(void)
+{
+    int i = static_cast<int>(Tier::TierAVX512);
+    int available = features();
+
+    /* the highest tier with all of it's features, BMI2 is optional */
+    while (i > static_cast<int>(Tier::TierScalar))
+    {
+        int required = maskOf(static_cast<Tier>(i)) & ~FeatureBMI2;
+
+        if ((available & required) == required)
+            break;
+
+        i--;
+    }
+
+    return static_cast<Tier>(i);
+}
+
+void limit(Tier tier)
+{
+    limited().store(maskOf(tier), std::memory_order_relaxed);
+}
+
+const char *nameOf(Tier tier)
+{
+    switch (tier)
+    {
+        case Tier::TierScalar : return "scalar";
+        case Tier::TierSSE2   : return "sse2";
+        case Tier::TierSSSE3  : return "ssse3";
+        case Tier::TierSSE42  : return "sse4.2";
+        case Tier::TierAVX2   : return "avx2";
+        default               : return "avx512";
+    }
+}
+}
+}
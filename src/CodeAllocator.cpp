@@ -0,0 +1,265 @@
+#include <new>
+#include <iterator>
+#include <cstring>
+#include <algorithm>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "CodeAllocator.h"
+#include "Pages.h"
+
+namespace FastRegExp
+{
+/* `int3` on x86, so jumping into released or padding bytes traps instead of running whatever is there */
+static const uint8_t Filler = 0xcc;
+
+static size_t roundUp(size_t size, size_t unit)
+{
+    return (size + unit - 1) / unit * unit;
+}
+
+Code::~Code()
+{
+    _allocator->release(_chunk, _offset, _size);
+}
+
+CodeAllocator::CodeAllocator() : _isShared(true) {}
+CodeAllocator::~CodeAllocator()
+{
+    for (auto &chunk : _chunks)
+        unmap(*chunk);
+}
+
+CodeAllocator &CodeAllocator::instance(void)
+{
+    static CodeAllocator *allocator = new CodeAllocator();
+    return *allocator;
+}
+
+bool CodeAllocator::mapShared(Chunk &chunk)
+{
+#if defined(__linux__) && defined(MFD_CLOEXEC)
+    bool isHuge = false;
+    Pages::Policy policy = Pages::policy();
+    int fd = -1;
+
+#ifdef MFD_HUGETLB
+    /* explicit huge pages come from their own memory object, regular ones when the pool is empty */
+    if (policy == Pages::Policy::PolicyExplicit && chunk.size % Pages::HugePageSize == 0)
+        isHuge = (fd = memfd_create("FastRegExp", MFD_CLOEXEC | MFD_HUGETLB)) >= 0;
+#endif
+
+    for (;;)
+    {
+        if (fd < 0 && (fd = memfd_create("FastRegExp", MFD_CLOEXEC)) < 0)
+            return false;
+
+        if (ftruncate(fd, static_cast<off_t>(chunk.size)) < 0)
+        {
+            close(fd);
+            return false;
+        }
+
+        /* the mappings keep the memory object alive on their own */
+        void *writable = mmap(nullptr, chunk.size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        void *executable = mmap(nullptr, chunk.size, PROT_READ | PROT_EXEC, MAP_SHARED, fd, 0);
+
+        close(fd);
+        fd = -1;
+
+        if (writable != MAP_FAILED && executable != MAP_FAILED)
+        {
+            /* the kernel may refuse, regular pages work all the same */
+            if (!isHuge && policy != Pages::Policy::PolicyNormal)
+            {
+                Pages::advise(writable, chunk.size);
+                Pages::advise(executable, chunk.size);
+            }
+
+            chunk.writable = static_cast<uint8_t *>(writable);
+            chunk.executable = static_cast<uint8_t *>(executable);
+            return true;
+        }
+
+        if (writable != MAP_FAILED) munmap(writable, chunk.size);
+        if (executable != MAP_FAILED) munmap(executable, chunk.size);
+
+        if (!isHuge)
+            return false;
+
+        isHuge = false;
+    }
+#else
+    (void)chunk;
+    return false;
+#endif
+}
+
+void CodeAllocator::unmap(Chunk &chunk)
+{
+    if (chunk.writable)
+        munmap(chunk.writable, chunk.size);
+
+    munmap(chunk.executable, chunk.size);
+}
+
+void CodeAllocator::release(void *chunk, size_t offset, size_t size)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    size_t need = roundUp(std::max(size, static_cast<size_t>(1)), Alignment);
+    auto owner = std::find_if(_chunks.begin(), _chunks.end(), [&](const std::unique_ptr<Chunk> &x){ return x.get() == chunk; });
+    Chunk &block = **owner;
+
+    block.used -= need;
+    _usage.used -= need;
+    _usage.functions--;
+
+    /* functions on pages of their own go away with them */
+    if (!block.writable)
+    {
+        unmap(block);
+        _usage.chunks--;
+        _usage.mapped -= block.size;
+        _chunks.erase(owner);
+        return;
+    }
+
+    memset(block.writable + offset, Filler, need);
+
+    /* merge with the free blocks on either side */
+    auto next = block.free.lower_bound(offset);
+
+    if (next != block.free.end() && offset + need == next->first)
+    {
+        need += next->second;
+        next = block.free.erase(next);
+    }
+
+    if (next != block.free.begin() && std::prev(next)->first + std::prev(next)->second == offset)
+        std::prev(next)->second += need;
+    else
+        block.free.emplace(offset, need);
+
+    /* one empty chunk is kept around, so adding and dropping a single pattern doesn't map and unmap every time */
+    if (block.used == 0)
+    {
+        for (auto &other : _chunks)
+        {
+            if (other.get() != &block && other->writable && other->used == 0)
+            {
+                unmap(block);
+                _usage.chunks--;
+                _usage.mapped -= block.size;
+                _chunks.erase(owner);
+                break;
+            }
+        }
+    }
+}
+
+std::shared_ptr<Code> CodeAllocator::allocate(const void *code, size_t size)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    Chunk *chunk = nullptr;
+    size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t need = roundUp(std::max(size, static_cast<size_t>(1)), Alignment);
+    std::map<size_t, size_t>::iterator block;
+
+    /* first fit within the chunks already mapped */
+    for (auto &item : _chunks)
+    {
+        if (!item->writable)
+            continue;
+
+        for (block = item->free.begin(); block != item->free.end(); ++block)
+            if (block->second >= need)
+                break;
+
+        if (block != item->free.end())
+        {
+            chunk = item.get();
+            break;
+        }
+    }
+
+    if (!chunk)
+    {
+        std::unique_ptr<Chunk> item(new Chunk());
+
+        /* whole huge pages when asked for, so a chunk takes a single TLB entry */
+        if (Pages::policy() == Pages::Policy::PolicyNormal)
+            item->size = roundUp(need > ChunkSize ? need : ChunkSize, page);
+        else
+            item->size = roundUp(need, Pages::HugePageSize);
+
+        /* without a second mapping the pages are written first, then sealed */
+        if (!_isShared || !mapShared(*item))
+        {
+            _isShared = false;
+            item->size = roundUp(need, page);
+
+            void *mem = mmap(nullptr, item->size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+            if (mem == MAP_FAILED)
+                throw std::bad_alloc();
+
+            memcpy(mem, code, size);
+            memset(static_cast<uint8_t *>(mem) + size, Filler, item->size - size);
+
+            if (mprotect(mem, item->size, PROT_READ | PROT_EXEC) < 0)
+            {
+                munmap(mem, item->size);
+                throw std::bad_alloc();
+            }
+
+            item->used = need;
+            item->writable = nullptr;
+            item->executable = static_cast<uint8_t *>(mem);
+            __builtin___clear_cache(reinterpret_cast<char *>(mem), reinterpret_cast<char *>(mem) + size);
+
+            _usage.used += need;
+            _usage.chunks++;
+            _usage.mapped += item->size;
+            _usage.functions++;
+            _chunks.push_back(std::move(item));
+
+            Chunk *owner = _chunks.back().get();
+            return std::shared_ptr<Code>(new Code(this, owner, 0, owner->executable, size));
+        }
+
+        memset(item->writable, Filler, item->size);
+        item->free.emplace(0, item->size);
+
+        _usage.chunks++;
+        _usage.mapped += item->size;
+        _chunks.push_back(std::move(item));
+
+        chunk = _chunks.back().get();
+        block = chunk->free.begin();
+    }
+
+    size_t offset = block->first;
+    size_t remain = block->second - need;
+
+    chunk->free.erase(block);
+
+    if (remain)
+        chunk->free.emplace(offset + need, remain);
+
+    memcpy(chunk->writable + offset, code, size);
+    __builtin___clear_cache(reinterpret_cast<char *>(chunk->executable + offset), reinterpret_cast<char *>(chunk->executable + offset + size));
+
+    chunk->used += need;
+    _usage.used += need;
+    _usage.functions++;
+    return std::shared_ptr<Code>(new Code(this, chunk, offset, chunk->executable + offset, size));
+}
+
+CodeAllocator::Usage CodeAllocator::usage(void)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _usage;
+}
+}
@@ -0,0 +1,1837 @@
+#include <map>
+#include <algorithm>
+
+#include "DFA.h"
+#include "Unicode.h"
+#include "Compiler.h"
+#include "Backtracker.h"
+
+typedef std::vector<std::pair<uint8_t, uint8_t>> Sequence;
+
+static inline size_t encodeUTF8(char32_t ch, uint8_t *buf)
+{
+    if (ch < 0x80)
+    {
+        buf[0] = static_cast<uint8_t>(ch);
+        return 1;
+    }
+    else if (ch < 0x800)
+    {
+        buf[0] = static_cast<uint8_t>(0xc0 | (ch >> 6));
+        buf[1] = static_cast<uint8_t>(0x80 | (ch & 0x3f));
+        return 2;
+    }
+    else if (ch < 0x10000)
+    {
+        buf[0] = static_cast<uint8_t>(0xe0 | (ch >> 12));
+        buf[1] = static_cast<uint8_t>(0x80 | ((ch >> 6) & 0x3f));
+        buf[2] = static_cast<uint8_t>(0x80 | (ch & 0x3f));
+        return 3;
+    }
+    else
+    {
+        buf[0] = static_cast<uint8_t>(0xf0 | (ch >> 18));
+        buf[1] = static_cast<uint8_t>(0x80 | ((ch >> 12) & 0x3f));
+        buf[2] = static_cast<uint8_t>(0x80 | ((ch >> 6) & 0x3f));
+        buf[3] = static_cast<uint8_t>(0x80 | (ch & 0x3f));
+        return 4;
+    }
+}
+
+/* split a code point range into byte range sequences, each byte of the sequence matches independently */
+static void splitUTF8(char32_t lower, char32_t upper, std::vector<Sequence> &result)
+{
+    static const char32_t limits[] = { 0x7f, 0x7ff, 0xffff };
+
+    /* surrogates can never be encoded */
+    if (lower <= 0xdfff && upper >= 0xd800)
+    {
+        if (lower < 0xd800) splitUTF8(lower, 0xd7ff, result);
+        if (upper > 0xdfff) splitUTF8(0xe000, upper, result);
+        return;
+    }
+
+    /* split on encoded length boundaries */
+    for (char32_t limit : limits)
+    {
+        if (lower <= limit && upper > limit)
+        {
+            splitUTF8(lower, limit, result);
+            splitUTF8(limit + 1, upper, result);
+            return;
+        }
+    }
+
+    /* every continuation byte except the leading ones must span it's full range */
+    for (size_t i = 1; i < 4; i++)
+    {
+        char32_t mask = (1u << (6 * i)) - 1;
+
+        if ((lower & ~mask) != (upper & ~mask))
+        {
+            if ((lower & mask) != 0)
+            {
+                splitUTF8(lower, lower | mask, result);
+                splitUTF8((lower | mask) + 1, upper, result);
+                return;
+            }
+
+            if ((upper & mask) != mask)
+            {
+                splitUTF8(lower, (upper & ~mask) - 1, result);
+                splitUTF8(upper & ~mask, upper, result);
+                return;
+            }
+        }
+    }
+
+    uint8_t lo[4];
+    uint8_t hi[4];
+    size_t size = encodeUTF8(lower, lo);
+    Sequence sequence;
+
+    encodeUTF8(upper, hi);
+    for (size_t i = 0; i < size; i++)
+        sequence.emplace_back(lo[i], hi[i]);
+
+    result.push_back(std::move(sequence));
+}
+
+/* a node of the byte automaton of a class, edges are disjoint byte ranges */
+struct SequenceNode
+{
+    struct Edge
+    {
+        uint8_t lower;
+        uint8_t upper;
+        ssize_t next;       /* -1 where a character ends */
+    };
+
+public:
+    std::vector<Edge> edges;
+
+};
+
+/* prefix tree of the sequences, they come sorted so a shared prefix is always on the last edges */
+static void buildTree(const std::vector<Sequence> &sequences, std::vector<SequenceNode> &nodes)
+{
+    nodes.assign(1, SequenceNode());
+
+    for (const Sequence &sequence : sequences)
+    {
+        size_t node = 0;
+
+        for (size_t i = 0; i < sequence.size(); i++)
+        {
+            bool isLast = i + 1 == sequence.size();
+            std::vector<SequenceNode::Edge> &edges = nodes[node].edges;
+
+            if (!isLast && !edges.empty() && edges.back().next >= 0 &&
+                edges.back().lower == sequence[i].first && edges.back().upper == sequence[i].second)
+            {
+                node = static_cast<size_t>(edges.back().next);
+                continue;
+            }
+
+            if (isLast)
+            {
+                edges.push_back({ sequence[i].first, sequence[i].second, -1 });
+                break;
+            }
+
+            edges.push_back({ sequence[i].first, sequence[i].second, static_cast<ssize_t>(nodes.size()) });
+            node = nodes.size();
+            nodes.emplace_back();
+        }
+    }
+}
+
+/* merges identical subtrees below `node`, so continuation bytes shared by many leading bytes are only
+ * compiled once. returns the node standing for `node` */
+static size_t shareSuffixes(std::vector<SequenceNode> &nodes, size_t node, std::map<std::string, size_t> &seen)
+{
+    std::string key;
+
+    for (SequenceNode::Edge &edge : nodes[node].edges)
+    {
+        if (edge.next >= 0)
+            edge.next = static_cast<ssize_t>(shareSuffixes(nodes, static_cast<size_t>(edge.next), seen));
+
+        key += static_cast<char>(edge.lower);
+        key += static_cast<char>(edge.upper);
+        key += std::to_string(edge.next) + ",";
+    }
+
+    return seen.emplace(std::move(key), node).first->second;
+}
+
+static void normalize(FastRegExp::Compiler::Ranges &ranges)
+{
+    size_t n = 0;
+    std::sort(ranges.begin(), ranges.end());
+
+    for (const auto &range : ranges)
+    {
+        if (n && range.first <= ranges[n - 1].second + 1)
+            ranges[n - 1].second = std::max(ranges[n - 1].second, range.second);
+        else
+            ranges[n++] = range;
+    }
+
+    ranges.resize(n);
+}
+
+static void invert(FastRegExp::Compiler::Ranges &ranges)
+{
+    char32_t next = 0;
+    FastRegExp::Compiler::Ranges result;
+
+    normalize(ranges);
+    for (const auto &range : ranges)
+    {
+        if (range.first > next)
+            result.emplace_back(next, range.first - 1);
+
+        next = range.second + 1;
+    }
+
+    if (next <= 0x10ffff)
+        result.emplace_back(next, 0x10ffff);
+
+    ranges.swap(result);
+}
+
+static bool overlaps(FastRegExp::Compiler::Ranges lhs, FastRegExp::Compiler::Ranges rhs)
+{
+    size_t i = 0;
+    size_t j = 0;
+
+    normalize(lhs);
+    normalize(rhs);
+
+    while (i < lhs.size() && j < rhs.size())
+    {
+        if (lhs[i].second < rhs[j].first)
+            i++;
+        else if (rhs[j].second < lhs[i].first)
+            j++;
+        else
+            return true;
+    }
+
+    return false;
+}
+
+static bool intersects(const FastRegExp::ByteSet &lhs, const FastRegExp::ByteSet &rhs)
+{
+    for (unsigned int ch = 0; ch < 256; ch++)
+        if (lhs.test(static_cast<uint8_t>(ch)) && rhs.test(static_cast<uint8_t>(ch)))
+            return true;
+
+    return false;
+}
+
+/* leading bytes of the encoded characters, a few more for ranges across encoded lengths */
+static FastRegExp::ByteSet leadsOf(const FastRegExp::Compiler::Ranges &ranges)
+{
+    uint8_t lo[4];
+    uint8_t hi[4];
+    FastRegExp::ByteSet set;
+
+    for (const auto &range : ranges)
+    {
+        encodeUTF8(range.first, lo);
+        encodeUTF8(range.second, hi);
+        set.addRange(lo[0], hi[0]);
+    }
+
+    return set;
+}
+
+namespace FastRegExp
+{
+size_t Compiler::emit(Instruction::Opcode opcode, size_t index)
+{
+    _program.code.emplace_back(opcode, index);
+    return _program.code.size() - 1;
+}
+
+size_t Compiler::addSet(const ByteSet &set)
+{
+    auto iter = std::find(_program.sets.begin(), _program.sets.end(), set);
+
+    if (iter != _program.sets.end())
+        return iter - _program.sets.begin();
+
+    _program.sets.push_back(set);
+    _program.scanners.emplace_back(set);
+    return _program.sets.size() - 1;
+}
+
+size_t Compiler::groupOf(const AST::RegExp *expr, ssize_t pos) const
+{
+    auto iter = _indexes.find(expr);
+
+    if (iter == _indexes.end())
+        throw SyntaxError(pos, "Unresolved group reference");
+
+    return iter->second;
+}
+
+bool Compiler::isNullable(const AST::RegExp &node)
+{
+    return std::any_of(node.sections.begin(), node.sections.end(), [](const std::shared_ptr<AST::Section> &x)
+    {
+        return std::all_of(x->elements.begin(), x->elements.end(), [](const std::shared_ptr<AST::Elementry> &y)
+        {
+            return isNullable(*y);
+        });
+    });
+}
+
+bool Compiler::isNullable(const AST::Elementry &node)
+{
+    switch (node.modifier.type)
+    {
+        case AST::Elementry::Modifier::Type::ModifierStar     : return true;
+        case AST::Elementry::Modifier::Type::ModifierQuestion : return true;
+        case AST::Elementry::Modifier::Type::ModifierRepeat   : if (node.modifier.lower == 0) return true; break;
+
+        case AST::Elementry::Modifier::Type::ModifierNone:
+        case AST::Elementry::Modifier::Type::ModifierPlus:
+            break;
+    }
+
+    switch (node.type)
+    {
+        case AST::Elementry::Type::ElementryAny           : return false;
+        case AST::Elementry::Type::ElementryRange         : return false;
+        case AST::Elementry::Type::ElementryEndOfString   : return true;
+        case AST::Elementry::Type::ElementryStartOfString : return true;
+
+        case AST::Elementry::Type::ElementrySubExpr:
+        {
+            switch (node.subexpr->type)
+            {
+                case AST::SubExpr::Type::SubExprSimple     : return isNullable(*node.subexpr->expr);
+                case AST::SubExpr::Type::SubExprReference  : return isNullable(*node.subexpr->expr);
+                case AST::SubExpr::Type::SubExprNonCapture : return isNullable(*node.subexpr->expr);
+
+                /* back-references and look-arounds */
+                default:
+                    return true;
+            }
+        }
+
+        case AST::Elementry::Type::ElementryCharacter:
+        {
+            switch (node.character->type)
+            {
+                case AST::Character::Type::CharacterBorder     : return true;
+                case AST::Character::Type::CharacterNonBorder  : return true;
+                case AST::Character::Type::CharacterMatchName  : return true;
+                case AST::Character::Type::CharacterMatchIndex : return true;
+                case AST::Character::Type::CharacterReference  : return isNullable(*node.character->reference);
+
+                default:
+                    return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+void Compiler::widthOf(const AST::RegExp &node, size_t &lower, ssize_t &upper)
+{
+    lower = SIZE_MAX;
+    upper = 0;
+
+    for (const auto &section : node.sections)
+    {
+        size_t min = 0;
+        ssize_t max = 0;
+
+        for (const auto &element : section->elements)
+        {
+            size_t lo;
+            ssize_t hi;
+
+            widthOf(*element, lo, hi);
+            min += lo;
+            max = (max < 0 || hi < 0) ? -1 : max + hi;
+        }
+
+        lower = std::min(lower, min);
+        upper = (upper < 0 || max < 0) ? -1 : std::max(upper, max);
+    }
+
+    if (lower == SIZE_MAX)
+        lower = 0;
+}
+
+void Compiler::widthOf(const AST::Elementry &node, size_t &lower, ssize_t &upper)
+{
+    Ranges ranges;
+    size_t count = 1;
+    ssize_t times = 1;
+
+    switch (node.modifier.type)
+    {
+        case AST::Elementry::Modifier::Type::ModifierNone     : break;
+        case AST::Elementry::Modifier::Type::ModifierPlus     : times = -1; break;
+        case AST::Elementry::Modifier::Type::ModifierStar     : count = 0; times = -1; break;
+        case AST::Elementry::Modifier::Type::ModifierQuestion : count = 0; break;
+        case AST::Elementry::Modifier::Type::ModifierRepeat   : count = node.modifier.lower; times = node.modifier.upper; break;
+    }
+
+    /* width of a single iteration, in bytes */
+    if (rangesOf(node, ranges))
+    {
+        uint8_t buf[4];
+        lower = ranges.empty() ? 1 : encodeUTF8(ranges.front().first, buf);
+        upper = ranges.empty() ? 1 : encodeUTF8(ranges.back().second, buf);
+    }
+    else if (node.type == AST::Elementry::Type::ElementrySubExpr)
+    {
+        switch (node.subexpr->type)
+        {
+            case AST::SubExpr::Type::SubExprSimple     : widthOf(*node.subexpr->expr, lower, upper); break;
+            case AST::SubExpr::Type::SubExprReference  : widthOf(*node.subexpr->expr, lower, upper); break;
+            case AST::SubExpr::Type::SubExprNonCapture : widthOf(*node.subexpr->expr, lower, upper); break;
+            case AST::SubExpr::Type::SubExprMatchName  : lower = 0; upper = -1; break;
+
+            /* look-arounds */
+            default:
+            {
+                lower = 0;
+                upper = 0;
+                break;
+            }
+        }
+    }
+    else if (node.type == AST::Elementry::Type::ElementryCharacter)
+    {
+        switch (node.character->type)
+        {
+            case AST::Character::Type::CharacterReference  : widthOf(*node.character->reference, lower, upper); break;
+            case AST::Character::Type::CharacterMatchName  : lower = 0; upper = -1; break;
+            case AST::Character::Type::CharacterMatchIndex : lower = 0; upper = -1; break;
+
+            /* word borders */
+            default:
+            {
+                lower = 0;
+                upper = 0;
+                break;
+            }
+        }
+    }
+    else
+    {
+        lower = 0;
+        upper = 0;
+    }
+
+    lower *= count;
+    upper = (upper == 0) ? 0 : (upper < 0 || times < 0) ? -1 : upper * times;
+}
+
+bool Compiler::unitsOf(const AST::RegExp &node, std::vector<ByteSet> &units)
+{
+    if (node.sections.size() != 1)
+        return false;
+
+    for (const auto &element : node.sections.front()->elements)
+        if (!unitsOf(*element, units) || units.size() > MaxLookWidth)
+            return false;
+
+    return true;
+}
+
+bool Compiler::unitsOf(const AST::Elementry &node, std::vector<ByteSet> &units)
+{
+    Ranges ranges;
+    size_t count = 1;
+    std::vector<ByteSet> once;
+
+    switch (node.modifier.type)
+    {
+        case AST::Elementry::Modifier::Type::ModifierNone:
+            break;
+
+        case AST::Elementry::Modifier::Type::ModifierRepeat:
+        {
+            if (node.modifier.upper != static_cast<ssize_t>(node.modifier.lower) || node.modifier.lower > MaxLookWidth)
+                return false;
+
+            count = node.modifier.lower;
+            break;
+        }
+
+        default:
+            return false;
+    }
+
+    /* either a single ASCII byte set, or a single non-ASCII character */
+    if (rangesOf(node, ranges))
+    {
+        if (ranges.empty())
+            return false;
+
+        if (ranges.back().second < 0x80)
+        {
+            ByteSet set;
+            std::for_each(ranges.begin(), ranges.end(), [&](auto x){ set.addRange(static_cast<uint8_t>(x.first), static_cast<uint8_t>(x.second)); });
+            once.push_back(set);
+        }
+        else if (ranges.size() == 1 && ranges.front().first == ranges.front().second)
+        {
+            uint8_t buf[4];
+            size_t size = encodeUTF8(ranges.front().first, buf);
+
+            for (size_t i = 0; i < size; i++)
+            {
+                once.emplace_back();
+                once.back().add(buf[i]);
+            }
+        }
+        else
+        {
+            return false;
+        }
+    }
+    else if (node.type == AST::Elementry::Type::ElementrySubExpr)
+    {
+        if (node.subexpr->type != AST::SubExpr::Type::SubExprReference &&
+            node.subexpr->type != AST::SubExpr::Type::SubExprNonCapture)
+            return false;
+
+        if (!unitsOf(*node.subexpr->expr, once))
+            return false;
+    }
+    else
+    {
+        return false;
+    }
+
+    if (count * once.size() > MaxLookWidth)
+        return false;
+
+    for (size_t i = 0; i < count; i++)
+        units.insert(units.end(), once.begin(), once.end());
+
+    return true;
+}
+
+bool Compiler::rangesOf(const AST::Elementry &node, Ranges &ranges)
+{
+    switch (node.type)
+    {
+        case AST::Elementry::Type::ElementryAny:
+        {
+            if (node.flags & AST::Flags::FlagDotAll)
+            {
+                ranges.emplace_back(0, 0x10ffff);
+                return true;
+            }
+
+            ranges.emplace_back(U'\n', U'\n');
+            invert(ranges);
+            return true;
+        }
+
+        case AST::Elementry::Type::ElementryRange:
+        {
+            Ranges classes;
+
+            for (const auto &item : node.range->items)
+            {
+                if (item.second == nullptr)
+                {
+                    if (item.first->type == AST::Character::Type::CharacterSimple ||
+                        item.first->type == AST::Character::Type::CharacterControl)
+                        rangesOf(*item.first, ranges);
+                    else
+                        rangesOf(*item.first, classes);
+
+                    continue;
+                }
+
+                if ((item.first->type != AST::Character::Type::CharacterSimple &&
+                     item.first->type != AST::Character::Type::CharacterControl) ||
+                    (item.second->type != AST::Character::Type::CharacterSimple &&
+                     item.second->type != AST::Character::Type::CharacterControl))
+                    throw SyntaxError(item.first->pos(), "Invalid range boundary");
+
+                if (item.first->character > item.second->character)
+                    throw SyntaxError(item.first->pos(), "Invalid range, lower bound is greater than upper bound");
+
+                ranges.emplace_back(item.first->character, item.second->character);
+            }
+
+            /* character classes like '\w' are not affected by case folding */
+            if (node.flags & AST::Flags::FlagIgnoreCase)
+                Unicode::foldRanges(ranges);
+
+            ranges.insert(ranges.end(), classes.begin(), classes.end());
+
+            if (node.range->isInverted)
+                invert(ranges);
+            else
+                normalize(ranges);
+
+            return true;
+        }
+
+        case AST::Elementry::Type::ElementryCharacter:
+        {
+            switch (node.character->type)
+            {
+                case AST::Character::Type::CharacterBorder:
+                case AST::Character::Type::CharacterNonBorder:
+                case AST::Character::Type::CharacterReference:
+                case AST::Character::Type::CharacterMatchName:
+                case AST::Character::Type::CharacterMatchIndex:
+                    return false;
+
+                case AST::Character::Type::CharacterSimple:
+                case AST::Character::Type::CharacterControl:
+                {
+                    rangesOf(*node.character, ranges);
+
+                    if (node.flags & AST::Flags::FlagIgnoreCase)
+                        Unicode::foldRanges(ranges);
+
+                    normalize(ranges);
+                    return true;
+                }
+
+                default:
+                {
+                    rangesOf(*node.character, ranges);
+                    normalize(ranges);
+                    return true;
+                }
+            }
+        }
+
+        default:
+            return false;
+    }
+}
+
+void Compiler::rangesOf(const AST::Character &node, Ranges &ranges)
+{
+    Ranges other;
+
+    switch (node.type)
+    {
+        case AST::Character::Type::CharacterWord:
+        {
+            ranges.emplace_back(U'0', U'9');
+            ranges.emplace_back(U'A', U'Z');
+            ranges.emplace_back(U'_', U'_');
+            ranges.emplace_back(U'a', U'z');
+            break;
+        }
+
+        case AST::Character::Type::CharacterDigit:
+        {
+            ranges.emplace_back(U'0', U'9');
+            break;
+        }
+
+        case AST::Character::Type::CharacterSpace:
+        {
+            ranges.emplace_back(U'\t', U'\r');
+            ranges.emplace_back(U' ', U' ');
+            break;
+        }
+
+        case AST::Character::Type::CharacterNonWord:
+        {
+            other.emplace_back(U'0', U'9');
+            other.emplace_back(U'A', U'Z');
+            other.emplace_back(U'_', U'_');
+            other.emplace_back(U'a', U'z');
+            invert(other);
+            ranges.insert(ranges.end(), other.begin(), other.end());
+            break;
+        }
+
+        case AST::Character::Type::CharacterNonDigit:
+        {
+            other.emplace_back(U'0', U'9');
+            invert(other);
+            ranges.insert(ranges.end(), other.begin(), other.end());
+            break;
+        }
+
+        case AST::Character::Type::CharacterNonSpace:
+        {
+            other.emplace_back(U'\t', U'\r');
+            other.emplace_back(U' ', U' ');
+            invert(other);
+            ranges.insert(ranges.end(), other.begin(), other.end());
+            break;
+        }
+
+        case AST::Character::Type::CharacterProperty:
+        {
+            Unicode::propertyRanges(node.name, ranges);
+            break;
+        }
+
+        case AST::Character::Type::CharacterNonProperty:
+        {
+            Unicode::propertyRanges(node.name, other);
+            invert(other);
+            ranges.insert(ranges.end(), other.begin(), other.end());
+            break;
+        }
+
+        case AST::Character::Type::CharacterSimple:
+        case AST::Character::Type::CharacterControl:
+        {
+            if (node.character > 0x10ffff)
+                throw SyntaxError(node.pos(), "Invalid code point");
+
+            ranges.emplace_back(node.character, node.character);
+            break;
+        }
+
+        default:
+            throw SyntaxError(node.pos(), "Invalid character inside range");
+    }
+}
+
+void Compiler::charsOf(const AST::RegExp &node, Ranges &ranges)
+{
+    for (const auto &section : node.sections)
+        for (const auto &element : section->elements)
+            charsOf(*element, ranges);
+}
+
+void Compiler::charsOf(const AST::Elementry &node, Ranges &ranges)
+{
+    Ranges own;
+
+    if (rangesOf(node, own))
+    {
+        ranges.insert(ranges.end(), own.begin(), own.end());
+        return;
+    }
+
+    if (node.type == AST::Elementry::Type::ElementrySubExpr)
+    {
+        switch (node.subexpr->type)
+        {
+            case AST::SubExpr::Type::SubExprSimple     : charsOf(*node.subexpr->expr, ranges); break;
+            case AST::SubExpr::Type::SubExprReference  : charsOf(*node.subexpr->expr, ranges); break;
+            case AST::SubExpr::Type::SubExprNonCapture : charsOf(*node.subexpr->expr, ranges); break;
+            case AST::SubExpr::Type::SubExprMatchName  : ranges.emplace_back(0, 0x10ffff); break;
+
+            /* look-arounds consume nothing */
+            default:
+                break;
+        }
+    }
+    else if (node.type == AST::Elementry::Type::ElementryCharacter)
+    {
+        switch (node.character->type)
+        {
+            case AST::Character::Type::CharacterReference  : charsOf(*node.character->reference, ranges); break;
+            case AST::Character::Type::CharacterMatchName  : ranges.emplace_back(0, 0x10ffff); break;
+            case AST::Character::Type::CharacterMatchIndex : ranges.emplace_back(0, 0x10ffff); break;
+
+            /* word borders */
+            default:
+                break;
+        }
+    }
+}
+
+void Compiler::firstOf(const AST::RegExp &node, Ranges &ranges)
+{
+    for (const auto &section : node.sections)
+        firstOf(*section, 0, ranges);
+}
+
+void Compiler::firstOf(const AST::Elementry &node, Ranges &ranges)
+{
+    Ranges own;
+
+    if (rangesOf(node, own))
+    {
+        ranges.insert(ranges.end(), own.begin(), own.end());
+        return;
+    }
+
+    if (node.type == AST::Elementry::Type::ElementrySubExpr)
+    {
+        switch (node.subexpr->type)
+        {
+            case AST::SubExpr::Type::SubExprSimple     : firstOf(*node.subexpr->expr, ranges); break;
+            case AST::SubExpr::Type::SubExprReference  : firstOf(*node.subexpr->expr, ranges); break;
+            case AST::SubExpr::Type::SubExprNonCapture : firstOf(*node.subexpr->expr, ranges); break;
+            case AST::SubExpr::Type::SubExprMatchName  : ranges.emplace_back(0, 0x10ffff); break;
+
+            /* look-arounds */
+            default:
+                break;
+        }
+    }
+    else if (node.type == AST::Elementry::Type::ElementryCharacter)
+    {
+        switch (node.character->type)
+        {
+            case AST::Character::Type::CharacterReference  : firstOf(*node.character->reference, ranges); break;
+            case AST::Character::Type::CharacterMatchName  : ranges.emplace_back(0, 0x10ffff); break;
+            case AST::Character::Type::CharacterMatchIndex : ranges.emplace_back(0, 0x10ffff); break;
+
+            /* word borders */
+            default:
+                break;
+        }
+    }
+}
+
+bool Compiler::firstOf(const AST::Section &node, size_t begin, Ranges &ranges)
+{
+    for (size_t i = begin; i < node.elements.size(); i++)
+    {
+        firstOf(*node.elements[i], ranges);
+
+        if (!isNullable(*node.elements[i]))
+            return false;
+    }
+
+    return true;
+}
+
+bool Compiler::isAnchored(const AST::RegExp &node, bool atEnd)
+{
+    auto type = atEnd ? AST::Elementry::Type::ElementryEndOfString : AST::Elementry::Type::ElementryStartOfString;
+
+    /* every alternative must start or end with the assertion, or with a group anchored the same way */
+    return !node.sections.empty() && std::all_of(node.sections.begin(), node.sections.end(), [&](auto section)
+    {
+        if (section->elements.empty())
+            return false;
+
+        const AST::Elementry &element = atEnd ? *section->elements.back() : *section->elements.front();
+
+        if (element.modifier.type != AST::Elementry::Modifier::Type::ModifierNone)
+            return false;
+
+        if (element.type == type)
+            return !(element.flags & AST::Flags::FlagMultiLine);
+
+        if (element.type != AST::Elementry::Type::ElementrySubExpr)
+            return false;
+
+        switch (element.subexpr->type)
+        {
+            case AST::SubExpr::Type::SubExprSimple     : return isAnchored(*element.subexpr->expr, atEnd);
+            case AST::SubExpr::Type::SubExprNonCapture : return isAnchored(*element.subexpr->expr, atEnd);
+
+            default:
+                return false;
+        }
+    });
+}
+
+bool Compiler::isUnbounded(const AST::Elementry &node)
+{
+    switch (node.modifier.type)
+    {
+        case AST::Elementry::Modifier::Type::ModifierPlus   : return true;
+        case AST::Elementry::Modifier::Type::ModifierStar   : return true;
+        case AST::Elementry::Modifier::Type::ModifierRepeat : return node.modifier.upper < 0;
+
+        default:
+            return false;
+    }
+}
+
+bool Compiler::isCounted(const AST::Elementry &node)
+{
+    /* several iterations in a row, as if unrolled */
+    return node.modifier.type == AST::Elementry::Modifier::Type::ModifierRepeat &&
+           (node.modifier.lower > 1 || node.modifier.upper > 1);
+}
+
+bool Compiler::isAmbiguous(const AST::RegExp &node, const Ranges &follow)
+{
+    std::vector<Ranges> firsts(node.sections.size());
+
+    /* alternatives that may match the same input */
+    for (size_t i = 0; i < node.sections.size(); i++)
+        firstOf(*node.sections[i], 0, firsts[i]);
+
+    for (size_t i = 0; i < node.sections.size(); i++)
+        for (size_t j = i + 1; j < node.sections.size(); j++)
+            if (overlaps(firsts[i], firsts[j]) && isAmbiguous(*node.sections[i], *node.sections[j], follow))
+                return true;
+
+    /* loops that may also consume what comes after them */
+    for (const auto &section : node.sections)
+    {
+        for (size_t i = 0; i < section->elements.size(); i++)
+        {
+            Ranges next;
+            const AST::Elementry &element = *section->elements[i];
+
+            if (firstOf(*section, i + 1, next))
+                next.insert(next.end(), follow.begin(), follow.end());
+
+            if (isUnbounded(element))
+            {
+                Ranges chars;
+                charsOf(element, chars);
+
+                if (overlaps(chars, next))
+                    return true;
+            }
+            else if (element.type == AST::Elementry::Type::ElementrySubExpr &&
+                     (element.modifier.type == AST::Elementry::Modifier::Type::ModifierNone ||
+                      element.modifier.type == AST::Elementry::Modifier::Type::ModifierQuestion))
+            {
+                switch (element.subexpr->type)
+                {
+                    case AST::SubExpr::Type::SubExprSimple:
+                    case AST::SubExpr::Type::SubExprReference:
+                    case AST::SubExpr::Type::SubExprNonCapture:
+                    {
+                        if (isAmbiguous(*element.subexpr->expr, next))
+                            return true;
+
+                        break;
+                    }
+
+                    default:
+                        break;
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+bool Compiler::isAmbiguous(const AST::Section &lhs, const AST::Section &rhs, const Ranges &follow)
+{
+    std::vector<ByteSet> a;
+    std::vector<ByteSet> b;
+
+    /* anything but fixed sequences of bytes is assumed to be ambiguous */
+    for (const auto &element : lhs.elements)
+        if (!unitsOf(*element, a) || a.size() > MaxLookWidth)
+            return true;
+
+    for (const auto &element : rhs.elements)
+        if (!unitsOf(*element, b) || b.size() > MaxLookWidth)
+            return true;
+
+    size_t size = std::min(a.size(), b.size());
+
+    for (size_t i = 0; i < size; i++)
+        if (!intersects(a[i], b[i]))
+            return false;
+
+    /* one is a prefix of the other, which is ambiguous only if the rest of the longer one may also come next */
+    if (a.size() == b.size())
+        return true;
+    else
+        return intersects(a.size() > b.size() ? a[size] : b[size], leadsOf(follow));
+}
+
+void Compiler::analyzeProgram(void)
+{
+    _program.analysis.isMemoizable = std::none_of(_program.code.begin(), _program.code.end(), [](const Instruction &ins)
+    {
+        switch (ins.opcode)
+        {
+            /* these depend on captures, registers or the stack below them */
+            case Instruction::Opcode::OpcodeBackref      : return true;
+            case Instruction::Opcode::OpcodeLookEnd      : return true;
+            case Instruction::Opcode::OpcodeProgress     : return true;
+            case Instruction::Opcode::OpcodeLookaround   : return true;
+            case Instruction::Opcode::OpcodeCounterInit  : return true;
+            case Instruction::Opcode::OpcodeCounterIncr  : return true;
+            case Instruction::Opcode::OpcodeCounterLoop  : return true;
+
+            default:
+                return false;
+        }
+    });
+}
+
+void Compiler::analyzeRegExp(const AST::RegExp &node)
+{
+    for (const auto &section : node.sections)
+        for (const auto &element : section->elements)
+            analyzeElementry(*element);
+}
+
+void Compiler::analyzeElementry(const AST::Elementry &node)
+{
+    Analysis &analysis = _program.analysis;
+
+    if (node.type == AST::Elementry::Type::ElementryCharacter)
+    {
+        if (node.character->type == AST::Character::Type::CharacterMatchName ||
+            node.character->type == AST::Character::Type::CharacterMatchIndex)
+            analysis.hasBackrefs = true;
+
+        return;
+    }
+
+    if (node.type != AST::Elementry::Type::ElementrySubExpr)
+        return;
+
+    switch (node.subexpr->type)
+    {
+        case AST::SubExpr::Type::SubExprMatchName:
+        {
+            analysis.hasBackrefs = true;
+            return;
+        }
+
+        /* referenced groups are analyzed where they are defined */
+        case AST::SubExpr::Type::SubExprReference:
+            break;
+
+        case AST::SubExpr::Type::SubExprSimple:
+        case AST::SubExpr::Type::SubExprNonCapture:
+        {
+            analyzeRegExp(*node.subexpr->expr);
+            break;
+        }
+
+        default:
+        {
+            analysis.hasLookarounds = true;
+            analyzeRegExp(*node.subexpr->expr);
+            return;
+        }
+    }
+
+    /* inner loops are analyzed first, so the innermost one is reported. counted repeats are analyzed as their
+     * unrolled sequence, where an iteration is followed by the next one the same way */
+    if (analysis.riskPos < 0 && (isUnbounded(node) || isCounted(node)))
+    {
+        Ranges follow;
+        firstOf(*node.subexpr->expr, follow);
+
+        /* empty iterations of a counted repeat let the non-empty ones shift among them */
+        if (isAmbiguous(*node.subexpr->expr, follow) || (isCounted(node) && !follow.empty() && isNullable(*node.subexpr->expr)))
+        {
+            analysis.risk = "Iterations of this loop may match the same input in several ways";
+            analysis.riskPos = node.pos();
+        }
+    }
+}
+
+void Compiler::compileAlternatives(size_t count, const std::function<void(size_t)> &compileOne)
+{
+    std::vector<size_t> jumps;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        /* the last alternative doesn't need a split */
+        if (i == count - 1)
+        {
+            compileOne(i);
+            break;
+        }
+
+        size_t split = emit(Instruction::Opcode::OpcodeSplit);
+        _program.code[split].x = split + 1;
+
+        compileOne(i);
+        jumps.push_back(emit(Instruction::Opcode::OpcodeJump));
+        _program.code[split].y = _program.code.size();
+    }
+
+    for (size_t jump : jumps)
+        _program.code[jump].x = _program.code.size();
+}
+
+void Compiler::flushLiteral(Literal &literal)
+{
+    if (literal.bytes.empty())
+        return;
+
+    /* single bytes doesn't worth a literal */
+    if (literal.bytes.size() != 1)
+    {
+        _program.literals.push_back(std::move(literal));
+        emit(Instruction::Opcode::OpcodeLiteral, _program.literals.size() - 1);
+    }
+    else if (!literal.masks[0])
+    {
+        emit(Instruction::Opcode::OpcodeByte, static_cast<uint8_t>(literal.bytes[0]));
+    }
+    else
+    {
+        ByteSet set;
+        set.add(static_cast<uint8_t>(literal.bytes[0]));
+        set.add(static_cast<uint8_t>(literal.bytes[0] & ~0x20));
+        emit(Instruction::Opcode::OpcodeSet, addSet(set));
+    }
+
+    literal.bytes.clear();
+    literal.masks.clear();
+}
+
+bool Compiler::appendLiteral(const AST::Elementry &node, Literal &literal)
+{
+    uint8_t buf[4];
+    size_t size;
+    char32_t ch;
+
+    if (node.type != AST::Elementry::Type::ElementryCharacter ||
+        node.modifier.type != AST::Elementry::Modifier::Type::ModifierNone)
+        return false;
+
+    if (node.character->type != AST::Character::Type::CharacterSimple &&
+        node.character->type != AST::Character::Type::CharacterControl)
+        return false;
+
+    if ((ch = node.character->character) > 0x10ffff)
+        return false;
+
+    /* caseless characters are fine */
+    if (!(node.flags & AST::Flags::FlagIgnoreCase) || Unicode::simpleFold(ch) == ch)
+    {
+        size = encodeUTF8(ch, buf);
+        literal.bytes.append(reinterpret_cast<const char *>(buf), size);
+        literal.masks.append(size, 0);
+        return true;
+    }
+
+    /* ASCII letters without non-ASCII case variants can be compared with the case bit masked out */
+    if (ch < 0x80 && Unicode::simpleFold(Unicode::simpleFold(ch)) == ch && Unicode::simpleFold(ch) == (ch ^ 0x20))
+    {
+        literal.bytes.push_back(static_cast<char>(ch | 0x20));
+        literal.masks.push_back(0x20);
+        return true;
+    }
+
+    /* otherwise it's a character class */
+    return false;
+}
+
+bool Compiler::isShareable(const AST::Elementry &node)
+{
+    /* plain characters and assertions are cheaper to compile than to look up */
+    switch (node.type)
+    {
+        case AST::Elementry::Type::ElementryEndOfString   : return false;
+        case AST::Elementry::Type::ElementryStartOfString : return false;
+
+        case AST::Elementry::Type::ElementryCharacter:
+        {
+            if (node.modifier.type != AST::Elementry::Modifier::Type::ModifierNone)
+                return true;
+
+            switch (node.character->type)
+            {
+                case AST::Character::Type::CharacterBorder    : return false;
+                case AST::Character::Type::CharacterNonBorder : return false;
+                case AST::Character::Type::CharacterSimple    : return (node.flags & AST::Flags::FlagIgnoreCase) != 0;
+                case AST::Character::Type::CharacterControl   : return (node.flags & AST::Flags::FlagIgnoreCase) != 0;
+
+                default:
+                    return true;
+            }
+        }
+
+        default:
+            return true;
+    }
+}
+
+void Compiler::loadFragment(const Fragments::Fragment &fragment)
+{
+    Relocation relocation;
+
+    relocation.code = static_cast<ssize_t>(_program.code.size());
+    relocation.literals = static_cast<ssize_t>(_program.literals.size());
+    relocation.sequences = static_cast<ssize_t>(_program.sequences.size());
+    relocation.registers = static_cast<ssize_t>(_program.registers);
+
+    for (const ByteSet &set : fragment.sets)
+        relocation.sets.push_back(addSet(set));
+
+    for (Instruction ins : fragment.code)
+    {
+        relocation.apply(ins);
+        _program.code.push_back(ins);
+    }
+
+    for (const std::vector<size_t> &sequence : fragment.sequences)
+    {
+        _program.sequences.push_back(sequence);
+        relocation.apply(_program.sequences.back());
+    }
+
+    _program.literals.insert(_program.literals.end(), fragment.literals.begin(), fragment.literals.end());
+    _program.registers += fragment.registers;
+}
+
+std::shared_ptr<const Fragments::Fragment> Compiler::saveFragment(size_t begin, size_t literals, size_t sequences, size_t registers) const
+{
+    Relocation relocation;
+    std::shared_ptr<Fragments::Fragment> fragment = std::make_shared<Fragments::Fragment>();
+
+    relocation.code = -static_cast<ssize_t>(begin);
+    relocation.literals = -static_cast<ssize_t>(literals);
+    relocation.sequences = -static_cast<ssize_t>(sequences);
+    relocation.registers = -static_cast<ssize_t>(registers);
+    relocation.sets.assign(_program.sets.size(), SIZE_MAX);
+
+    /* sets are shared with the rest of the program, only the ones used are taken along */
+    auto take = [&](size_t set)
+    {
+        if (relocation.sets[set] == SIZE_MAX)
+        {
+            relocation.sets[set] = fragment->sets.size();
+            fragment->sets.push_back(_program.sets[set]);
+        }
+    };
+
+    for (size_t pc = begin; pc < _program.code.size(); pc++)
+        if (_program.code[pc].opcode == Instruction::Opcode::OpcodeSet || _program.code[pc].opcode == Instruction::Opcode::OpcodeRepeatSet)
+            take(_program.code[pc].index);
+
+    for (size_t i = sequences; i < _program.sequences.size(); i++)
+        std::for_each(_program.sequences[i].begin(), _program.sequences[i].end(), take);
+
+    for (size_t pc = begin; pc < _program.code.size(); pc++)
+    {
+        fragment->code.push_back(_program.code[pc]);
+        relocation.apply(fragment->code.back());
+    }
+
+    for (size_t i = sequences; i < _program.sequences.size(); i++)
+    {
+        fragment->sequences.push_back(_program.sequences[i]);
+        relocation.apply(fragment->sequences.back());
+    }
+
+    fragment->registers = _program.registers - registers;
+    fragment->literals.assign(_program.literals.begin() + literals, _program.literals.end());
+    return fragment;
+}
+
+void Compiler::compileFragment(const AST::Elementry &node)
+{
+    std::string key;
+    std::shared_ptr<const Fragments::Fragment> fragment;
+
+    /* only the outermost shareable elements are looked up, the ones within are compiled along with them */
+    if (!_fragments || _isRecording || !isShareable(node) || !node.appendKey(key))
+    {
+        compileElementry(node);
+        return;
+    }
+
+    if ((fragment = _fragments->find(key)))
+    {
+        loadFragment(*fragment);
+        return;
+    }
+
+    size_t begin = _program.code.size();
+    size_t literals = _program.literals.size();
+    size_t sequences = _program.sequences.size();
+    size_t registers = _program.registers;
+
+    _isRecording = true;
+    compileElementry(node);
+    _isRecording = false;
+    _fragments->insert(std::move(key), saveFragment(begin, literals, sequences, registers));
+}
+
+void Compiler::compileRegExp(const AST::RegExp &node)
+{
+    compileAlternatives(node.sections.size(), [&](size_t i){ compileSection(*node.sections[i]); });
+}
+
+void Compiler::compileSection(const AST::Section &node)
+{
+    Literal literal;
+
+    /* consecutive plain characters are merged into literals */
+    for (const auto &element : node.elements)
+    {
+        if (!appendLiteral(*element, literal))
+        {
+            flushLiteral(literal);
+            compileFragment(*element);
+        }
+    }
+
+    flushLiteral(literal);
+}
+
+void Compiler::compileElementry(const AST::Elementry &node)
+{
+    switch (node.modifier.type)
+    {
+        case AST::Elementry::Modifier::Type::ModifierNone     : compileAtom(node); break;
+        case AST::Elementry::Modifier::Type::ModifierPlus     : compileRepeat(node, 1, -1); break;
+        case AST::Elementry::Modifier::Type::ModifierStar     : compileRepeat(node, 0, -1); break;
+        case AST::Elementry::Modifier::Type::ModifierQuestion : compileRepeat(node, 0,  1); break;
+
+        case AST::Elementry::Modifier::Type::ModifierRepeat:
+        {
+            if (node.modifier.upper >= 0 && node.modifier.lower > static_cast<size_t>(node.modifier.upper))
+                throw SyntaxError(node.pos(), "Invalid repeat range, lower bound is greater than upper bound");
+
+            compileRepeat(node, node.modifier.lower, node.modifier.upper);
+            break;
+        }
+    }
+}
+
+void Compiler::compileAtom(const AST::Elementry &node)
+{
+    switch (node.type)
+    {
+        case AST::Elementry::Type::ElementrySubExpr: compileSubExpr(*node.subexpr, node.flags); break;
+
+        case AST::Elementry::Type::ElementryEndOfString:
+        {
+            if (node.flags & AST::Flags::FlagMultiLine)
+                emit(Instruction::Opcode::OpcodeAssert, static_cast<size_t>(Instruction::Assertion::AssertionEndOfLine));
+            else
+                emit(Instruction::Opcode::OpcodeAssert, static_cast<size_t>(Instruction::Assertion::AssertionEndOfString));
+
+            break;
+        }
+
+        case AST::Elementry::Type::ElementryStartOfString:
+        {
+            if (node.flags & AST::Flags::FlagMultiLine)
+                emit(Instruction::Opcode::OpcodeAssert, static_cast<size_t>(Instruction::Assertion::AssertionStartOfLine));
+            else
+                emit(Instruction::Opcode::OpcodeAssert, static_cast<size_t>(Instruction::Assertion::AssertionStartOfString));
+
+            break;
+        }
+
+        case AST::Elementry::Type::ElementryAny:
+        case AST::Elementry::Type::ElementryRange:
+        {
+            Ranges ranges;
+            rangesOf(node, ranges);
+            compileRanges(ranges);
+            break;
+        }
+
+        case AST::Elementry::Type::ElementryCharacter:
+        {
+            compileCharacter(*node.character, node.flags);
+            break;
+        }
+    }
+}
+
+void Compiler::compileRanges(const Ranges &ranges)
+{
+    ByteSet ascii;
+    std::vector<size_t> ends;
+    std::vector<Sequence> sequences;
+    std::vector<SequenceNode> nodes;
+    std::map<std::string, size_t> seen;
+
+    for (const auto &range : ranges)
+    {
+        if (range.first < 0x80)
+            ascii.addRange(static_cast<uint8_t>(range.first), static_cast<uint8_t>(std::min<char32_t>(range.second, 0x7f)));
+
+        if (range.second >= 0x80)
+            splitUTF8(std::max<char32_t>(range.first, 0x80), range.second, sequences);
+    }
+
+    /* all ASCII characters are matched by a single set */
+    if (sequences.empty())
+    {
+        emit(Instruction::Opcode::OpcodeSet, addSet(ascii));
+        return;
+    }
+
+    if (ascii.count())
+    {
+        size_t split = emit(Instruction::Opcode::OpcodeSplit);
+
+        _program.code[split].x = split + 1;
+        emit(Instruction::Opcode::OpcodeSet, addSet(ascii));
+        ends.push_back(emit(Instruction::Opcode::OpcodeJump));
+        _program.code[split].y = _program.code.size();
+    }
+
+    /* longer characters go through a byte automaton, edges of a node never overlap so at most one of them
+     * matches, and merged subtrees are compiled once and jumped to */
+    buildTree(sequences, nodes);
+    shareSuffixes(nodes, 0, seen);
+
+    std::vector<ssize_t> addresses(nodes.size(), -1);
+    std::function<void(size_t)> compileNode = [&](size_t node)
+    {
+        const std::vector<SequenceNode::Edge> &edges = nodes[node].edges;
+
+        addresses[node] = static_cast<ssize_t>(_program.code.size());
+
+        for (size_t i = 0; i < edges.size(); i++)
+        {
+            size_t split = 0;
+            const SequenceNode::Edge &edge = edges[i];
+
+            /* the last edge doesn't need a split */
+            if (i + 1 < edges.size())
+            {
+                split = emit(Instruction::Opcode::OpcodeSplit);
+                _program.code[split].x = split + 1;
+            }
+
+            if (edge.lower == edge.upper)
+            {
+                emit(Instruction::Opcode::OpcodeByte, edge.lower);
+            }
+            else
+            {
+                ByteSet set;
+                set.addRange(edge.lower, edge.upper);
+                emit(Instruction::Opcode::OpcodeSet, addSet(set));
+            }
+
+            if (edge.next < 0)
+                ends.push_back(emit(Instruction::Opcode::OpcodeJump));
+            else if (addresses[edge.next] < 0)
+                compileNode(static_cast<size_t>(edge.next));
+            else
+                _program.code[emit(Instruction::Opcode::OpcodeJump)].x = static_cast<size_t>(addresses[edge.next]);
+
+            if (i + 1 < edges.size())
+                _program.code[split].y = _program.code.size();
+        }
+    };
+
+    compileNode(0);
+
+    /* the last character may simply fall through */
+    if (ends.back() + 1 == _program.code.size())
+    {
+        ends.pop_back();
+        _program.code.pop_back();
+    }
+
+    for (size_t jump : ends)
+        _program.code[jump].x = _program.code.size();
+}
+
+bool Compiler::isUnrollable(const AST::Elementry &node, size_t copies, bool isOptional)
+{
+    AST::Elementry atom = node;
+    atom.modifier = AST::Elementry::Modifier();
+
+    if (copies <= MaxUnroll)
+        return true;
+
+    if (copies > DFA::MaxRepeat)
+        return false;
+
+    /* optional copies of a nullable element may each be skipped or matched empty, which multiplies the paths
+     * of the backtracker, only counters stop at the first empty iteration */
+    if (isOptional && isNullable(atom))
+        return false;
+
+    size_t code = _program.code.size();
+    size_t sets = _program.sets.size();
+    size_t literals = _program.literals.size();
+    size_t sequences = _program.sequences.size();
+    size_t registers = _program.registers;
+
+    /* one copy is compiled to measure it, then taken back */
+    compileAtom(node);
+    size_t size = _program.code.size() - code;
+
+    _program.code.erase(_program.code.begin() + code, _program.code.end());
+    _program.sets.erase(_program.sets.begin() + sets, _program.sets.end());
+    _program.scanners.erase(_program.scanners.begin() + sets, _program.scanners.end());
+    _program.literals.erase(_program.literals.begin() + literals, _program.literals.end());
+    _program.sequences.erase(_program.sequences.begin() + sequences, _program.sequences.end());
+    _program.registers = registers;
+    return size * copies <= MaxUnrollSize;
+}
+
+void Compiler::compileRepeat(const AST::Elementry &node, size_t lower, ssize_t upper)
+{
+    Ranges ranges;
+    bool isLazy = node.modifier.isLazy;
+    bool isSet = rangesOf(node, ranges) && !ranges.empty();
+
+    /* single byte loops are consumed in one instruction regardless of the bounds */
+    if (isSet && ranges.back().second < 0x80)
+    {
+        ByteSet set;
+        std::for_each(ranges.begin(), ranges.end(), [&](auto x){ set.addRange(static_cast<uint8_t>(x.first), static_cast<uint8_t>(x.second)); });
+
+        size_t pc = emit(Instruction::Opcode::OpcodeRepeatSet, addSet(set));
+        _program.code[pc].lower = lower;
+        _program.code[pc].upper = upper;
+        _program.code[pc].isLazy = isLazy;
+        return;
+    }
+
+    /* classes taking every non-ASCII character, like '.' and negated ones, loop over bytes as well when unbounded.
+     * the loop only stops in front of a lead or ASCII byte, so it ends where the UTF-8 automaton would, though it
+     * also takes malformed sequences. at least one byte is at least one character, larger bounds are not kept */
+    if (isSet && upper < 0 && lower <= 1 && ranges.back().first <= 0x80 && ranges.back().second == 0x10ffff)
+    {
+        ByteSet set;
+        std::for_each(ranges.begin(), ranges.end(), [&](auto x){ if (x.first < 0x80) set.addRange(static_cast<uint8_t>(x.first), static_cast<uint8_t>(std::min<char32_t>(x.second, 0x7f))); });
+        set.addRange(0x80, 0xff);
+
+        size_t pc = emit(Instruction::Opcode::OpcodeRepeatSet, addSet(set));
+        _program.code[pc].lower = lower;
+        _program.code[pc].upper = upper;
+        _program.code[pc].isLazy = isLazy;
+        _program.code[pc].isWhole = true;
+        return;
+    }
+
+    /* small bounded repetitions are unrolled */
+    if (upper >= 0 && isUnrollable(node, static_cast<size_t>(upper), static_cast<size_t>(upper) > lower))
+    {
+        std::vector<size_t> splits;
+
+        for (size_t i = 0; i < lower; i++)
+            compileAtom(node);
+
+        for (size_t i = lower; i < static_cast<size_t>(upper); i++)
+        {
+            splits.push_back(emit(Instruction::Opcode::OpcodeSplit));
+            compileAtom(node);
+        }
+
+        for (size_t split : splits)
+        {
+            if (isLazy)
+            {
+                _program.code[split].x = _program.code.size();
+                _program.code[split].y = split + 1;
+            }
+            else
+            {
+                _program.code[split].x = split + 1;
+                _program.code[split].y = _program.code.size();
+            }
+        }
+
+        return;
+    }
+
+    /* empty iterations must terminate the loop, only possible if a single iteration may be empty */
+    size_t mark = 0;
+    AST::Elementry atom = node;
+
+    atom.modifier = AST::Elementry::Modifier();
+    bool nullable = isNullable(atom);
+
+    if (nullable)
+        mark = _program.registers++;
+
+    if (upper < 0 && isUnrollable(node, std::max(lower, static_cast<size_t>(1)), false))
+    {
+        size_t loop;
+        size_t split = 0;
+        size_t progress = 0;
+
+        /* leading mandatory iterations, the last one becomes the loop body of '+' */
+        for (size_t i = 1; i < lower; i++)
+            compileAtom(node);
+
+        if (lower == 0)
+            split = emit(Instruction::Opcode::OpcodeSplit);
+
+        loop = _program.code.size();
+
+        if (nullable)
+            emit(Instruction::Opcode::OpcodeMark, mark);
+
+        compileAtom(node);
+
+        if (nullable)
+            progress = emit(Instruction::Opcode::OpcodeProgress, mark);
+
+        if (lower == 0)
+        {
+            _program.code[emit(Instruction::Opcode::OpcodeJump)].x = split;
+            _program.code[split].x = isLazy ? _program.code.size() : loop;
+            _program.code[split].y = isLazy ? loop : _program.code.size();
+        }
+        else
+        {
+            size_t back = emit(Instruction::Opcode::OpcodeSplit);
+            _program.code[back].x = isLazy ? _program.code.size() : loop;
+            _program.code[back].y = isLazy ? loop : _program.code.size();
+        }
+
+        if (nullable)
+            _program.code[progress].x = _program.code.size();
+
+        return;
+    }
+
+    /* large repetitions are counted at runtime, the body is compiled only once */
+    size_t counter = _program.registers++;
+    size_t progress = 0;
+
+    emit(Instruction::Opcode::OpcodeCounterInit, counter);
+    size_t loop = emit(Instruction::Opcode::OpcodeCounterLoop, counter);
+
+    if (nullable)
+        emit(Instruction::Opcode::OpcodeMark, mark);
+
+    compileAtom(node);
+
+    /* empty iterations only terminate the loop after the mandatory ones */
+    if (nullable)
+    {
+        progress = emit(Instruction::Opcode::OpcodeProgress, mark);
+        _program.code[progress].y = counter + 1;
+        _program.code[progress].lower = lower;
+    }
+
+    emit(Instruction::Opcode::OpcodeCounterIncr, counter);
+    _program.code[emit(Instruction::Opcode::OpcodeJump)].x = loop;
+
+    _program.code[loop].x = loop + 1;
+    _program.code[loop].y = _program.code.size();
+    _program.code[loop].lower = lower;
+    _program.code[loop].upper = upper;
+    _program.code[loop].isLazy = isLazy;
+
+    if (nullable)
+        _program.code[progress].x = _program.code.size();
+}
+
+void Compiler::compileSubExpr(const AST::SubExpr &node, int flags)
+{
+    switch (node.type)
+    {
+        case AST::SubExpr::Type::SubExprReference  : compileRegExp(*node.expr); break;
+        case AST::SubExpr::Type::SubExprNonCapture : compileRegExp(*node.expr); break;
+
+        case AST::SubExpr::Type::SubExprSimple:
+        {
+            size_t index = groupOf(node.expr.get(), node.pos());
+
+            emit(Instruction::Opcode::OpcodeSave, index * 2);
+            compileRegExp(*node.expr);
+            emit(Instruction::Opcode::OpcodeSave, index * 2 + 1);
+            break;
+        }
+
+        case AST::SubExpr::Type::SubExprMatchName:
+        {
+            size_t pc = emit(Instruction::Opcode::OpcodeBackref, groupOf(_parser.namedGroups().at(node.name).get(), node.pos()));
+            _program.code[pc].isCaseless = (flags & AST::Flags::FlagIgnoreCase) != 0;
+            break;
+        }
+
+        case AST::SubExpr::Type::SubExprPositiveLookahead:
+        case AST::SubExpr::Type::SubExprNegativeLookahead:
+        case AST::SubExpr::Type::SubExprPositiveLookbehind:
+        case AST::SubExpr::Type::SubExprNegativeLookbehind:
+        {
+            compileLookaround(node);
+            break;
+        }
+    }
+}
+
+void Compiler::compileLookaround(const AST::SubExpr &node)
+{
+    size_t pc;
+    size_t end;
+    size_t lower = 0;
+    ssize_t upper = 0;
+    size_t target = 0;
+    std::vector<ByteSet> units;
+
+    bool isBehind = node.type == AST::SubExpr::Type::SubExprPositiveLookbehind ||
+                    node.type == AST::SubExpr::Type::SubExprNegativeLookbehind;
+
+    bool isNegative = node.type == AST::SubExpr::Type::SubExprNegativeLookahead ||
+                      node.type == AST::SubExpr::Type::SubExprNegativeLookbehind;
+
+    /* fixed-width bodies are compared in place without a sub-match */
+    if (unitsOf(*node.expr, units) && !units.empty())
+    {
+        Literal literal;
+        std::vector<size_t> sequence;
+
+        for (const ByteSet &set : units)
+        {
+            for (unsigned int ch = 0; ch < 256 && literal.bytes.size() == sequence.size(); ch++)
+            {
+                ByteSet other;
+                other.add(static_cast<uint8_t>(ch));
+                other.add(static_cast<uint8_t>(ch | 0x20));
+
+                if (set.count() == 1 && set.test(static_cast<uint8_t>(ch)))
+                {
+                    literal.bytes.push_back(static_cast<char>(ch));
+                    literal.masks.push_back(0);
+                }
+                else if (set.count() == 2 && ch != (ch | 0x20) && Backtracker::isAlpha(static_cast<uint8_t>(ch)) && set == other)
+                {
+                    literal.bytes.push_back(static_cast<char>(ch | 0x20));
+                    literal.masks.push_back(0x20);
+                }
+            }
+
+            sequence.push_back(addSet(set));
+        }
+
+        if (literal.bytes.size() == units.size())
+        {
+            _program.literals.push_back(std::move(literal));
+            pc = emit(Instruction::Opcode::OpcodeLookLiteral, _program.literals.size() - 1);
+        }
+        else
+        {
+            _program.sequences.push_back(std::move(sequence));
+            pc = emit(Instruction::Opcode::OpcodeLookSets, _program.sequences.size() - 1);
+        }
+
+        _program.code[pc].isBehind = isBehind;
+        _program.code[pc].isNegative = isNegative;
+        return;
+    }
+
+    /* look-behinds try every possible width, and the body must end at where it started */
+    if (isBehind)
+    {
+        widthOf(*node.expr, lower, upper);
+        target = _program.registers++;
+
+        if (upper < 0)
+            throw SyntaxError(node.pos(), "Look-behind requires a bounded width");
+    }
+
+    pc = emit(Instruction::Opcode::OpcodeLookaround, target);
+    compileRegExp(*node.expr);
+    end = emit(Instruction::Opcode::OpcodeLookEnd, target);
+
+    _program.code[end].isBehind = isBehind;
+    _program.code[pc].x = pc + 1;
+    _program.code[pc].y = end + 1;
+    _program.code[pc].lower = lower;
+    _program.code[pc].upper = upper;
+    _program.code[pc].isBehind = isBehind;
+    _program.code[pc].isNegative = isNegative;
+}
+
+void Compiler::compileCharacter(const AST::Character &node, int flags)
+{
+    switch (node.type)
+    {
+        case AST::Character::Type::CharacterBorder    : emit(Instruction::Opcode::OpcodeAssert, static_cast<size_t>(Instruction::Assertion::AssertionWordBorder)); break;
+        case AST::Character::Type::CharacterNonBorder : emit(Instruction::Opcode::OpcodeAssert, static_cast<size_t>(Instruction::Assertion::AssertionNonWordBorder)); break;
+        case AST::Character::Type::CharacterReference : compileRegExp(*node.reference); break;
+
+        case AST::Character::Type::CharacterMatchName:
+        {
+            size_t pc = emit(Instruction::Opcode::OpcodeBackref, groupOf(_parser.namedGroups().at(node.name).get(), node.pos()));
+            _program.code[pc].isCaseless = (flags & AST::Flags::FlagIgnoreCase) != 0;
+            break;
+        }
+
+        case AST::Character::Type::CharacterMatchIndex:
+        {
+            if (node.index == 0 || node.index > _program.groups)
+                throw SyntaxError(node.pos(), "Invalid group number " + std::to_string(node.index));
+
+            size_t pc = emit(Instruction::Opcode::OpcodeBackref, node.index);
+            _program.code[pc].isCaseless = (flags & AST::Flags::FlagIgnoreCase) != 0;
+            break;
+        }
+
+        case AST::Character::Type::CharacterSimple:
+        case AST::Character::Type::CharacterControl:
+        {
+            uint8_t buf[4];
+            size_t size;
+
+            if (node.character > 0x10ffff)
+                throw SyntaxError(node.pos(), "Invalid code point");
+
+            /* case-insensitive characters are expanded into classes with all their case variants */
+            if ((flags & AST::Flags::FlagIgnoreCase) && Unicode::simpleFold(node.character) != node.character)
+            {
+                Ranges ranges = { std::make_pair(node.character, node.character) };
+                Unicode::foldRanges(ranges);
+                normalize(ranges);
+                compileRanges(ranges);
+                break;
+            }
+
+            /* literals are matched byte-by-byte in their UTF-8 form */
+            size = encodeUTF8(node.character, buf);
+            for (size_t i = 0; i < size; i++)
+                emit(Instruction::Opcode::OpcodeByte, buf[i]);
+
+            break;
+        }
+
+        default:
+        {
+            Ranges ranges;
+            rangesOf(node, ranges);
+            normalize(ranges);
+            compileRanges(ranges);
+            break;
+        }
+    }
+}
+
+Program Compiler::compile(const std::shared_ptr<AST::Node> &root)
+{
+    const AST::RegExp *node = dynamic_cast<const AST::RegExp *>(root.get());
+
+    if (node == nullptr)
+        throw SyntaxError(0, "Invalid syntax tree");
+
+    /* groups are numbered in the same order as the parser discovered them */
+    _indexes.clear();
+    _program = Program();
+    _isRecording = false;
+    _program.groups = _parser.groups().size();
+
+    for (size_t i = 0; i < _parser.groups().size(); i++)
+        _indexes.emplace(_parser.groups()[i].get(), i + 1);
+
+    for (const auto &item : _parser.namedGroups())
+        _program.names.emplace(Unicode::toString(item.first), _indexes.at(item.second.get()));
+
+    emit(Instruction::Opcode::OpcodeSave, 0);
+    compileRegExp(*node);
+    emit(Instruction::Opcode::OpcodeSave, 1);
+    emit(Instruction::Opcode::OpcodeMatch);
+
+    widthOf(*node, _program.analysis.minLength, _program.analysis.maxLength);
+    _program.analysis.isAnchoredEnd = isAnchored(*node, true);
+    _program.analysis.isAnchoredStart = isAnchored(*node, false);
+    analyzeRegExp(*node);
+    analyzeProgram();
+    return std::move(_program);
+}
+}
@@ -0,0 +1,408 @@
+#include <algorithm>
+
+#include "DFA.h"
+#include "Backtracker.h"
+
+namespace FastRegExp
+{
+bool DFA::isSupported(const Program &program)
+{
+    for (const Instruction &ins : program.code)
+    {
+        switch (ins.opcode)
+        {
+            case Instruction::Opcode::OpcodeBackref:
+            case Instruction::Opcode::OpcodeLookEnd:
+            case Instruction::Opcode::OpcodeLookSets:
+            case Instruction::Opcode::OpcodeLookLiteral:
+            case Instruction::Opcode::OpcodeLookaround:
+            case Instruction::Opcode::OpcodeCounterInit:
+            case Instruction::Opcode::OpcodeCounterIncr:
+            case Instruction::Opcode::OpcodeCounterLoop:
+                return false;
+
+            case Instruction::Opcode::OpcodeProgress:
+            {
+                if (ins.y)
+                    return false;
+
+                break;
+            }
+
+            case Instruction::Opcode::OpcodeRepeatSet:
+            {
+                if (ins.lower > MaxRepeat || ins.upper > static_cast<ssize_t>(MaxRepeat))
+                    return false;
+
+                break;
+            }
+
+            default:
+                break;
+        }
+    }
+
+    return true;
+}
+
+int DFA::flagsOf(int ch)
+{
+    return (Backtracker::isWord(static_cast<uint8_t>(ch)) ? FlagWord    : 0) |
+           (ch == '\n'                                    ? FlagNewLine : 0);
+}
+
+bool DFA::checkAssertion(Instruction::Assertion assertion, int flags, int next)
+{
+    /* `next` is the byte after the current position, -1 at the end of input */
+    switch (assertion)
+    {
+        case Instruction::Assertion::AssertionEndOfString   : return next < 0;
+        case Instruction::Assertion::AssertionStartOfString : return (flags & FlagStart) != 0;
+        case Instruction::Assertion::AssertionEndOfLine     : return next < 0 || next == '\n';
+        case Instruction::Assertion::AssertionStartOfLine   : return (flags & (FlagStart | FlagNewLine)) != 0;
+
+        case Instruction::Assertion::AssertionWordBorder:
+        case Instruction::Assertion::AssertionNonWordBorder:
+        {
+            bool prev = (flags & FlagWord) != 0;
+            bool word = next >= 0 && Backtracker::isWord(static_cast<uint8_t>(next));
+            return (prev != word) == (assertion == Instruction::Assertion::AssertionWordBorder);
+        }
+    }
+
+    return false;
+}
+
+bool DFA::closure(const State &state, int next, std::vector<uint64_t> &threads)
+{
+    bool matched = false;
+    std::vector<uint64_t> stack(state.threads.rbegin(), state.threads.rend());
+
+    /* a new match may start at every position between characters */
+    _epoch++;
+    _others.clear();
+
+    if (next < 0 || !Backtracker::isContinuation(static_cast<uint8_t>(next)))
+        stack.push_back(0);
+
+    while (!stack.empty())
+    {
+        uint64_t thread = stack.back();
+        stack.pop_back();
+
+        size_t pc = thread >> 32;
+        size_t sub = thread & 0xffffffff;
+
+        /* threads inside literals and repeats are rare, the rest are marked per instruction */
+        if (sub == 0)
+        {
+            if (_visits[pc] == _epoch)
+                continue;
+
+            _visits[pc] = _epoch;
+        }
+        else
+        {
+            if (std::find(_others.begin(), _others.end(), thread) != _others.end())
+                continue;
+
+            _others.push_back(thread);
+        }
+        const Instruction &ins = _program.code[pc];
+
+        switch (ins.opcode)
+        {
+            case Instruction::Opcode::OpcodeJump:
+            {
+                stack.push_back(static_cast<uint64_t>(ins.x) << 32);
+                break;
+            }
+
+            case Instruction::Opcode::OpcodeMark:
+            case Instruction::Opcode::OpcodeSave:
+            {
+                stack.push_back(static_cast<uint64_t>(pc + 1) << 32);
+                break;
+            }
+
+            case Instruction::Opcode::OpcodeMatch:
+            {
+                matched = true;
+                break;
+            }
+
+            /* priorities do not matter when only looking for any match */
+            case Instruction::Opcode::OpcodeSplit:
+            {
+                stack.push_back(static_cast<uint64_t>(ins.y) << 32);
+                stack.push_back(static_cast<uint64_t>(ins.x) << 32);
+                break;
+            }
+
+            case Instruction::Opcode::OpcodeProgress:
+            {
+                stack.push_back(static_cast<uint64_t>(ins.x) << 32);
+                stack.push_back(static_cast<uint64_t>(pc + 1) << 32);
+                break;
+            }
+
+            /* assertions are resolved here, with the previous byte encoded in the state flags */
+            case Instruction::Opcode::OpcodeAssert:
+            {
+                if (checkAssertion(static_cast<Instruction::Assertion>(ins.index), state.flags, next))
+                    stack.push_back(static_cast<uint64_t>(pc + 1) << 32);
+
+                break;
+            }
+
+            case Instruction::Opcode::OpcodeRepeatSet:
+            {
+                /* whole characters don't leave the loop in front of a continuation byte */
+                if (sub >= ins.lower && (!ins.isWhole || next < 0 || !Backtracker::isContinuation(static_cast<uint8_t>(next))))
+                    stack.push_back(static_cast<uint64_t>(pc + 1) << 32);
+
+                if (ins.upper < 0 || sub < static_cast<size_t>(ins.upper))
+                    threads.push_back(thread);
+
+                break;
+            }
+
+            default:
+            {
+                threads.push_back(thread);
+                break;
+            }
+        }
+    }
+
+    return matched;
+}
+
+size_t DFA::intern(int flags, std::vector<uint64_t> &&threads)
+{
+    /* none started past the beginning either */
+    if (_program.analysis.isAnchoredStart && threads.empty() && !(flags & FlagStart))
+        flags |= FlagDead;
+
+    std::string key(reinterpret_cast<const char *>(threads.data()), threads.size() * sizeof(uint64_t));
+    key.push_back(static_cast<char>(flags));
+
+    auto it = _cache.find(key);
+    if (it != _cache.end())
+        return it->second;
+
+    _states.push_back({ flags, -1, std::move(threads) });
+    _table.resize(_states.size() * Stride, -1);
+    _cache.emplace(std::move(key), _states.size() - 1);
+    return _states.size() - 1;
+}
+
+void DFA::flush(size_t *states, size_t count)
+{
+    std::vector<State> keep;
+
+    for (size_t i = 0; i < count; i++)
+        keep.push_back(_states[states[i]]);
+
+    _cache.clear();
+    _table.clear();
+    _states.clear();
+
+    /* lanes sharing a state share it again after interning */
+    for (size_t i = 0; i < count; i++)
+    {
+        int accepts = keep[i].accepts;
+        states[i] = intern(keep[i].flags, std::move(keep[i].threads));
+        _states[states[i]].accepts = accepts;
+    }
+}
+
+bool DFA::accepts(size_t state)
+{
+    std::vector<uint64_t> threads;
+
+    if (_states[state].accepts < 0)
+        _states[state].accepts = closure(_states[state], -1, threads);
+
+    return _states[state].accepts != 0;
+}
+
+size_t DFA::transit(size_t state, uint8_t ch)
+{
+    std::vector<uint64_t> next;
+    std::vector<uint64_t> threads;
+    bool matched = closure(_states[state], ch, threads);
+
+    for (uint64_t thread : threads)
+    {
+        size_t pc = thread >> 32;
+        size_t sub = thread & 0xffffffff;
+        const Instruction &ins = _program.code[pc];
+
+        switch (ins.opcode)
+        {
+            case Instruction::Opcode::OpcodeSet:
+            {
+                if (_program.sets[ins.index].test(ch))
+                    next.push_back(static_cast<uint64_t>(pc + 1) << 32);
+
+                break;
+            }
+
+            case Instruction::Opcode::OpcodeByte:
+            {
+                if (ch == ins.index)
+                    next.push_back(static_cast<uint64_t>(pc + 1) << 32);
+
+                break;
+            }
+
+            case Instruction::Opcode::OpcodeLiteral:
+            {
+                const Literal &literal = _program.literals[ins.index];
+
+                if ((ch | static_cast<uint8_t>(literal.masks[sub])) != static_cast<uint8_t>(literal.bytes[sub]))
+                    break;
+
+                if (sub + 1 == literal.bytes.size())
+                    next.push_back(static_cast<uint64_t>(pc + 1) << 32);
+                else
+                    next.push_back(thread + 1);
+
+                break;
+            }
+
+            /* unbounded repeats stop counting once `lower` is reached */
+            case Instruction::Opcode::OpcodeRepeatSet:
+            {
+                if (!_program.sets[ins.index].test(ch))
+                    break;
+
+                if (ins.upper >= 0 || sub < ins.lower)
+                    next.push_back(thread + 1);
+                else
+                    next.push_back(thread);
+
+                break;
+            }
+
+            default:
+                break;
+        }
+    }
+
+    std::sort(next.begin(), next.end());
+    next.erase(std::unique(next.begin(), next.end()), next.end());
+
+    int flags = flagsOf(ch) | (matched ? FlagMatch : 0);
+    size_t result = intern(flags, std::move(next));
+    _table[state * Stride + ch] = static_cast<int32_t>(result);
+    return result;
+}
+
+bool DFA::exec(const char *str, size_t len, size_t start)
+{
+    const uint8_t *data = reinterpret_cast<const uint8_t *>(str);
+
+    if (start > len)
+        return false;
+
+    /* flags of the initial state come from the byte before `start` */
+    size_t state = intern(start ? flagsOf(data[start - 1]) : FlagStart, {});
+
+    /* the budget is spent a block at a time, keeping the inner loop as it is */
+    size_t block = _budget ? Budget::Block : len - start;
+
+    for (size_t pos = start; pos < len;)
+    {
+        size_t end = len - pos > block ? pos + block : len;
+
+        if (_budget && !_budget->spend(end - pos))
+            return false;
+
+        for (; pos < end; pos++)
+        {
+            int32_t next = _table[state * Stride + data[pos]];
+
+            if (next >= 0)
+            {
+                state = static_cast<size_t>(next);
+            }
+            else
+            {
+                if (_states.size() >= MaxStates)
+                    flush(&state, 1);
+
+                size_t count = _states.size();
+                state = transit(state, data[pos]);
+
+                if (_budget && _states.size() > count && !_budget->create())
+                    return false;
+            }
+
+            /* dead states are checked on every byte, cached transitions lead into them as well */
+            if (_states[state].flags & (FlagMatch | FlagDead))
+                return (_states[state].flags & FlagMatch) != 0;
+        }
+    }
+
+    return accepts(state);
+}
+
+void DFA::execBatch(const char *const *strs, const size_t *lens, size_t count, bool *results)
+{
+    for (size_t base = 0; base < count; base += Lanes)
+    {
+        size_t pos[Lanes];
+        size_t states[Lanes];
+        size_t lanes = count - base < Lanes ? count - base : Lanes;
+        size_t active = lanes;
+
+        for (size_t i = 0; i < lanes; i++)
+        {
+            pos[i] = 0;
+            states[i] = intern(FlagStart, {});
+        }
+
+        /* finished lanes move their position to `SIZE_MAX` and are skipped */
+        while (active)
+        {
+            for (size_t i = 0; i < lanes; i++)
+            {
+                if (pos[i] == SIZE_MAX)
+                    continue;
+
+                if (pos[i] == lens[base + i])
+                {
+                    results[base + i] = accepts(states[i]);
+                    pos[i] = SIZE_MAX;
+                    active--;
+                    continue;
+                }
+
+                uint8_t ch = static_cast<uint8_t>(strs[base + i][pos[i]++]);
+                int32_t next = _table[states[i] * Stride + ch];
+
+                if (next >= 0)
+                {
+                    states[i] = static_cast<size_t>(next);
+                }
+                else
+                {
+                    if (_states.size() >= MaxStates)
+                        flush(states, lanes);
+
+                    states[i] = transit(states[i], ch);
+                }
+
+                if (_states[states[i]].flags & (FlagMatch | FlagDead))
+                {
+                    results[base + i] = (_states[states[i]].flags & FlagMatch) != 0;
+                    pos[i] = SIZE_MAX;
+                    active--;
+                }
+            }
+        }
+    }
+}
+}
@@ -0,0 +1,559 @@
+#include <map>
+#include <deque>
+#include <thread>
+#include <algorithm>
+#include <system_error>
+
+#include "DenseDFA.h"
+#include "Backtracker.h"
+
+namespace FastRegExp
+{
+/* end state of a chunk walk that went through a matching state */
+static const uint32_t Matched = UINT32_MAX;
+
+size_t DenseDFA::startOf(int flags)
+{
+    switch (flags)
+    {
+        case DFA::FlagStart   : return 0;
+        case DFA::FlagWord    : return 2;
+        case DFA::FlagNewLine : return 3;
+        default               : return 1;
+    }
+}
+
+void DenseDFA::classify(const Program &program, std::array<uint8_t, 256> &map, size_t &classes)
+{
+    ByteSet set;
+    std::vector<ByteSet> tests = program.sets;
+
+    /* every byte set the program can tell apart, including the ones that change the state flags */
+    for (unsigned int ch = 0; ch < 256; ch++)
+        if (Backtracker::isWord(static_cast<uint8_t>(ch)))
+            set.add(static_cast<uint8_t>(ch));
+
+    tests.push_back(set);
+    tests.emplace_back();
+    tests.back().add('\n');
+    tests.emplace_back();
+
+    /* matches don't start on continuation bytes */
+    for (unsigned int ch = 0x80; ch < 0xc0; ch++)
+        tests.back().add(static_cast<uint8_t>(ch));
+
+    for (const Instruction &ins : program.code)
+    {
+        if (ins.opcode == Instruction::Opcode::OpcodeByte)
+        {
+            tests.emplace_back();
+            tests.back().add(static_cast<uint8_t>(ins.index));
+        }
+        else if (ins.opcode == Instruction::Opcode::OpcodeLiteral)
+        {
+            const Literal &literal = program.literals[ins.index];
+
+            for (size_t i = 0; i < literal.bytes.size(); i++)
+            {
+                tests.emplace_back();
+
+                for (unsigned int ch = 0; ch < 256; ch++)
+                    if ((ch | static_cast<uint8_t>(literal.masks[i])) == static_cast<uint8_t>(literal.bytes[i]))
+                        tests.back().add(static_cast<uint8_t>(ch));
+            }
+        }
+    }
+
+    /* refine the classes with one test at a time */
+    map.fill(0);
+    classes = 1;
+
+    for (const ByteSet &test : tests)
+    {
+        std::map<std::pair<uint8_t, bool>, uint8_t> renames;
+
+        for (unsigned int ch = 0; ch < 256; ch++)
+        {
+            auto key = std::make_pair(map[ch], test.test(static_cast<uint8_t>(ch)));
+            auto iter = renames.find(key);
+
+            if (iter == renames.end())
+                iter = renames.emplace(key, static_cast<uint8_t>(renames.size())).first;
+
+            map[ch] = iter->second;
+        }
+
+        classes = renames.size();
+    }
+}
+
+bool DenseDFA::build(const Program &program, size_t budget)
+{
+    DFA dfa(program);
+    std::vector<size_t> trans;
+    std::vector<uint8_t> reps;
+
+    if (!DFA::isSupported(program))
+        return false;
+
+    classify(program, _map, _classes);
+    reps.resize(_classes);
+
+    for (unsigned int ch = 256; ch-- > 0;)
+        reps[_map[ch]] = static_cast<uint8_t>(ch);
+
+    size_t starts[4] = {
+        dfa.intern(DFA::FlagStart, {}),
+        dfa.intern(0, {}),
+        dfa.intern(DFA::FlagWord, {}),
+        dfa.intern(DFA::FlagNewLine, {}),
+    };
+
+    /* explore every reachable state, matching states are final so they only loop to themselves */
+    for (size_t state = 0; state < dfa._states.size(); state++)
+    {
+        if (dfa._states.size() > MaxStates)
+            return false;
+
+        for (size_t cls = 0; cls < _classes; cls++)
+        {
+            if (dfa._states[state].flags & DFA::FlagMatch)
+                trans.push_back(state);
+            else
+                trans.push_back(dfa.transit(state, reps[cls]));
+        }
+    }
+
+    /* Hopcroft's algorithm, starting from matching, accepting at the end and the rest */
+    size_t count = dfa._states.size();
+    std::vector<size_t> work;
+    std::vector<bool> pending;
+    std::vector<size_t> blockOf(count);
+    std::vector<std::vector<size_t>> blocks(3);
+    std::vector<std::vector<size_t>> inverse(count * _classes);
+
+    for (size_t state = 0; state < count; state++)
+    {
+        if (dfa._states[state].flags & DFA::FlagMatch)
+            blockOf[state] = 2;
+        else
+            blockOf[state] = dfa.accepts(state) ? 1 : 0;
+
+        blocks[blockOf[state]].push_back(state);
+
+        for (size_t cls = 0; cls < _classes; cls++)
+            inverse[trans[state * _classes + cls] * _classes + cls].push_back(state);
+    }
+
+    for (size_t block = 0; block < blocks.size(); block++)
+    {
+        work.push_back(block);
+        pending.push_back(true);
+    }
+
+    while (!work.empty())
+    {
+        std::vector<size_t> splitter = blocks[work.back()];
+
+        pending[work.back()] = false;
+        work.pop_back();
+
+        for (size_t cls = 0; cls < _classes; cls++)
+        {
+            std::map<size_t, std::vector<size_t>> touched;
+
+            for (size_t target : splitter)
+                for (size_t state : inverse[target * _classes + cls])
+                    touched[blockOf[state]].push_back(state);
+
+            for (auto &item : touched)
+            {
+                size_t block = item.first;
+                size_t split = blocks.size();
+
+                if (item.second.size() == blocks[block].size())
+                    continue;
+
+                for (size_t state : item.second)
+                    blockOf[state] = split;
+
+                auto end = std::remove_if(blocks[block].begin(), blocks[block].end(), [&](size_t x){ return blockOf[x] != block; });
+                blocks[block].erase(end, blocks[block].end());
+                blocks.push_back(std::move(item.second));
+
+                /* only the smaller half needs to split others, unless both are still pending */
+                if (pending[block] || blocks[split].size() <= blocks[block].size())
+                {
+                    work.push_back(split);
+                    pending.push_back(true);
+                }
+                else
+                {
+                    work.push_back(block);
+                    pending[block] = true;
+                    pending.push_back(false);
+                }
+            }
+        }
+    }
+
+    /* number the blocks breadth first from the start states so neighbours share cache lines,
+     * the matching block goes last so a single comparison detects it */
+    std::deque<size_t> queue;
+    std::vector<size_t> ids(blocks.size(), SIZE_MAX);
+    size_t states = 0;
+    size_t dead = SIZE_MAX;
+    size_t matching = blocks[2].empty() ? SIZE_MAX : 2;
+
+    /* a state looping to itself on every byte without accepting can never match, anchored patterns end up
+     * there soon after the start. it goes right below the matching block, so walks stop there too */
+    for (size_t block = 0; block < blocks.size() && dead == SIZE_MAX; block++)
+    {
+        bool isDead = block != matching && !blocks[block].empty() && !dfa.accepts(blocks[block].front());
+
+        for (size_t cls = 0; isDead && cls < _classes; cls++)
+            isDead = blockOf[trans[blocks[block].front() * _classes + cls]] == block;
+
+        if (isDead)
+            dead = block;
+    }
+
+    for (size_t state : starts)
+    {
+        if (blockOf[state] != dead && ids[blockOf[state]] == SIZE_MAX)
+        {
+            ids[blockOf[state]] = states++;
+            queue.push_back(blockOf[state]);
+        }
+    }
+
+    while (!queue.empty())
+    {
+        size_t block = queue.front();
+        queue.pop_front();
+
+        for (size_t cls = 0; cls < _classes; cls++)
+        {
+            size_t next = blockOf[trans[blocks[block].front() * _classes + cls]];
+
+            if (next != matching && next != dead && ids[next] == SIZE_MAX)
+            {
+                ids[next] = states++;
+                queue.push_back(next);
+            }
+        }
+    }
+
+    if (dead != SIZE_MAX)
+        ids[dead] = states++;
+
+    if (matching != SIZE_MAX)
+        ids[matching] = states++;
+
+    /* premultiplied offsets, 16 bits each when they fit */
+    bool narrow = states * _classes <= UINT16_MAX + 1ul;
+
+    if (states * _classes * (narrow ? sizeof(uint16_t) : sizeof(uint32_t)) > budget)
+        return false;
+
+    std::vector<uint16_t> table16;
+    std::vector<uint32_t> table32;
+
+    _accepts.assign(states, false);
+    _matches = (matching == SIZE_MAX ? states : ids[matching]) * _classes;
+    _stops = dead == SIZE_MAX ? _matches : ids[dead] * _classes;
+
+    if (narrow)
+        table16.resize(states * _classes);
+    else
+        table32.resize(states * _classes);
+
+    for (size_t block = 0; block < blocks.size(); block++)
+    {
+        size_t id = ids[block];
+
+        if (id == SIZE_MAX)
+            continue;
+
+        size_t state = blocks[block].front();
+
+        _accepts[id] = block != matching && dfa.accepts(state);
+
+        for (size_t cls = 0; cls < _classes; cls++)
+        {
+            size_t next = ids[blockOf[trans[state * _classes + cls]]] * _classes;
+
+            if (narrow)
+                table16[id * _classes + cls] = static_cast<uint16_t>(next);
+            else
+                table32[id * _classes + cls] = static_cast<uint32_t>(next);
+        }
+    }
+
+    for (size_t i = 0; i < 4; i++)
+        _starts[i] = static_cast<uint32_t>(ids[blockOf[starts[i]]] * _classes);
+
+    /* built aside, then copied where the page policy and replication say */
+    if ((_isNarrow = narrow))
+        _table = TableAllocator::instance().allocate(table16.data(), table16.size() * sizeof(uint16_t));
+    else
+        _table = TableAllocator::instance().allocate(table32.data(), table32.size() * sizeof(uint32_t));
+
+    return true;
+}
+
+template <typename T>
+bool DenseDFA::walk(const T *table, const uint8_t *str, size_t len, size_t &state) const
+{
+    for (size_t pos = 0; pos < len; pos++)
+    {
+        state = table[state + _map[str[pos]]];
+
+        if (state >= _stops)
+            return true;
+    }
+
+    return false;
+}
+
+template <typename T>
+bool DenseDFA::run(const T *table, const uint8_t *str, size_t len, size_t state, Budget *budget) const
+{
+    size_t block = budget ? Budget::Block : len;
+
+    for (size_t pos = 0; pos < len; pos += block)
+    {
+        size_t size = len - pos > block ? block : len - pos;
+
+        if (budget && !budget->spend(size))
+            return false;
+
+        if (walk(table, str + pos, size, state))
+            return state >= _matches;
+    }
+
+    return _accepts[state / _classes];
+}
+
+template <typename T>
+void DenseDFA::mapChunk(const T *table, const uint8_t *str, size_t len, uint32_t *map) const
+{
+    size_t pos = 0;
+    size_t count = _matches / _classes;
+    std::vector<uint32_t> active(count);            /* distinct states still walking */
+    std::vector<uint32_t> owners(count);            /* where in `active` each starting state went, `Matched` once it matched */
+    std::vector<uint32_t> indexes(count, Matched);
+    std::vector<uint32_t> renumber;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        owners[i] = static_cast<uint32_t>(i);
+        active[i] = static_cast<uint32_t>(i * _classes);
+    }
+
+    /* walks starting apart usually meet after a few bytes, and stay together from there on */
+    while (pos < len && active.size() > 1)
+    {
+        size_t size = 0;
+        size_t end = len - pos > MergeInterval ? pos + MergeInterval : len;
+
+        for (uint32_t &state : active)
+        {
+            size_t next = state;
+
+            if (!walk(table, str + pos, end - pos, next) || next < _matches)
+                state = static_cast<uint32_t>(next);
+            else
+                state = Matched;
+        }
+
+        pos = end;
+        renumber.resize(active.size());
+
+        for (size_t i = 0; i < active.size(); i++)
+        {
+            if (active[i] == Matched)
+            {
+                renumber[i] = Matched;
+                continue;
+            }
+
+            uint32_t &index = indexes[active[i] / _classes];
+
+            if (index == Matched)
+            {
+                index = static_cast<uint32_t>(size);
+                active[size++] = active[i];
+            }
+
+            renumber[i] = index;
+        }
+
+        /* cleared on every round, even when nothing merged, or stale indexes renumber the next one */
+        for (size_t i = 0; i < size; i++)
+            indexes[active[i] / _classes] = Matched;
+
+        if (size == active.size())
+            continue;
+
+        for (uint32_t &owner : owners)
+            if (owner != Matched)
+                owner = renumber[owner];
+
+        active.resize(size);
+    }
+
+    if (active.size() == 1)
+    {
+        size_t state = active[0];
+
+        if (walk(table, str + pos, len - pos, state) && state >= _matches)
+            active[0] = Matched;
+        else
+            active[0] = static_cast<uint32_t>(state);
+    }
+
+    for (size_t i = 0; i < count; i++)
+        map[i] = owners[i] == Matched ? Matched : active[owners[i]];
+}
+
+template <typename T>
+void DenseDFA::runBatch(const T *table, const char *const *strs, const size_t *lens, size_t count, bool *results) const
+{
+    for (size_t base = 0; base < count; base += DFA::Lanes)
+    {
+        size_t pos[DFA::Lanes];
+        size_t states[DFA::Lanes];
+        size_t lanes = count - base < DFA::Lanes ? count - base : DFA::Lanes;
+        size_t active = lanes;
+
+        for (size_t i = 0; i < lanes; i++)
+        {
+            pos[i] = 0;
+            states[i] = _starts[startOf(DFA::FlagStart)];
+        }
+
+        /* finished lanes move their position to `SIZE_MAX` and are skipped */
+        while (active)
+        {
+            for (size_t i = 0; i < lanes; i++)
+            {
+                if (pos[i] == SIZE_MAX)
+                    continue;
+
+                if (pos[i] == lens[base + i])
+                {
+                    results[base + i] = _accepts[states[i] / _classes];
+                    pos[i] = SIZE_MAX;
+                    active--;
+                    continue;
+                }
+
+                states[i] = table[states[i] + _map[static_cast<uint8_t>(strs[base + i][pos[i]++])]];
+
+                if (states[i] >= _stops)
+                {
+                    results[base + i] = states[i] >= _matches;
+                    pos[i] = SIZE_MAX;
+                    active--;
+                }
+            }
+        }
+    }
+}
+
+template <typename T>
+bool DenseDFA::runParallel(const T *table, const uint8_t *str, size_t len, size_t state, size_t threads) const
+{
+    size_t chunks = std::min(threads, len / MinChunk);
+
+    if (chunks < 2)
+        return run(table, str, len, state, nullptr);
+
+    bool matched;
+    size_t count = _matches / _classes;
+    size_t size = len / chunks;
+    std::vector<std::thread> workers;
+    std::vector<uint32_t> maps((chunks - 1) * count);
+
+    /* where each state goes at the end of every chunk but the first, the last chunk takes the remainder */
+    auto worker = [&](size_t chunk)
+    {
+        size_t begin = chunk * size;
+        size_t end = chunk + 1 == chunks ? len : begin + size;
+
+        mapChunk(table, str + begin, end - begin, &maps[(chunk - 1) * count]);
+    };
+
+    for (size_t chunk = 1; chunk < chunks; chunk++)
+    {
+        /* running short of threads only makes it slower */
+        try
+        {
+            workers.emplace_back(worker, chunk);
+        }
+        catch (const std::system_error &)
+        {
+            worker(chunk);
+        }
+    }
+
+    matched = walk(table, str, size, state) && state >= _matches;
+
+    for (auto &thread : workers)
+        thread.join();
+
+    for (size_t chunk = 1; !matched && chunk < chunks; chunk++)
+    {
+        uint32_t next = maps[(chunk - 1) * count + state / _classes];
+
+        if (next == Matched)
+            matched = true;
+        else
+            state = next;
+    }
+
+    return matched || _accepts[state / _classes];
+}
+
+bool DenseDFA::exec(const char *str, size_t len, size_t start, Budget *budget) const
+{
+    const uint8_t *data = reinterpret_cast<const uint8_t *>(str);
+
+    if (start > len)
+        return false;
+
+    size_t state = _starts[startOf(start ? DFA::flagsOf(data[start - 1]) : DFA::FlagStart)];
+
+    if (_isNarrow)
+        return run(static_cast<const uint16_t *>(_table->data()), data + start, len - start, state, budget);
+    else
+        return run(static_cast<const uint32_t *>(_table->data()), data + start, len - start, state, budget);
+}
+
+void DenseDFA::execBatch(const char *const *strs, const size_t *lens, size_t count, bool *results) const
+{
+    if (_isNarrow)
+        runBatch(static_cast<const uint16_t *>(_table->data()), strs, lens, count, results);
+    else
+        runBatch(static_cast<const uint32_t *>(_table->data()), strs, lens, count, results);
+}
+
+bool DenseDFA::execParallel(const char *str, size_t len, size_t start, size_t threads) const
+{
+    const uint8_t *data = reinterpret_cast<const uint8_t *>(str);
+
+    if (start > len)
+        return false;
+
+    if (threads == 0)
+        threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+    size_t state = _starts[startOf(start ? DFA::flagsOf(data[start - 1]) : DFA::FlagStart)];
+
+    if (_isNarrow)
+        return runParallel(static_cast<const uint16_t *>(_table->data()), data + start, len - start, state, threads);
+    else
+        return runParallel(static_cast<const uint32_t *>(_table->data()), data + start, len - start, state, threads);
+}
+}
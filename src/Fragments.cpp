@@ -0,0 +1,64 @@
+#include <algorithm>
+
+#include "Fragments.h"
+
+namespace FastRegExp
+{
+Fragments::Fragments(size_t limit) : _limit(std::max(limit, static_cast<size_t>(1))) {}
+
+size_t Fragments::size(void) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _fragments.size();
+}
+
+size_t Fragments::hits(void) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _hits;
+}
+
+void Fragments::clear(void)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _hits = 0;
+    _uses.clear();
+    _fragments.clear();
+}
+
+std::shared_ptr<const Fragments::Fragment> Fragments::find(const std::string &key)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto iter = _fragments.find(key);
+
+    if (iter == _fragments.end())
+        return nullptr;
+
+    _hits++;
+    _uses.splice(_uses.begin(), _uses, iter->second.use);
+    return iter->second.fragment;
+}
+
+void Fragments::insert(std::string &&key, std::shared_ptr<const Fragment> fragment)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto iter = _fragments.find(key);
+
+    /* compiled by another thread meanwhile, either copy does */
+    if (iter != _fragments.end())
+    {
+        _uses.splice(_uses.begin(), _uses, iter->second.use);
+        return;
+    }
+
+    /* programs keep their own copies, so dropping one only costs compiling it again */
+    if (_fragments.size() >= _limit)
+    {
+        _fragments.erase(*_uses.back());
+        _uses.pop_back();
+    }
+
+    iter = _fragments.emplace(std::move(key), Entry { std::move(fragment), _uses.end() }).first;
+    iter->second.use = _uses.insert(_uses.begin(), &iter->first);
+}
+}
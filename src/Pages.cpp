@@ -0,0 +1,234 @@
+#include <atomic>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+#include "Pages.h"
+
+/* `MPOL_PREFERRED` of <numaif.h>, which needs libnuma headers that are not always installed */
+static const int PreferredPolicy = 1;
+
+static size_t roundUp(size_t size, size_t unit)
+{
+    return (size + unit - 1) / unit * unit;
+}
+
+/* parses lists like "0-3,8,10-11" as used under /sys, empty if the file can't be read */
+static std::vector<size_t> readList(const std::string &path)
+{
+    std::string line;
+    std::ifstream file(path);
+    std::vector<size_t> items;
+
+    if (!std::getline(file, line))
+        return items;
+
+    for (const char *p = line.c_str(); *p; )
+    {
+        char *end;
+        size_t lower = strtoul(p, &end, 10);
+        size_t upper = lower;
+
+        if (end == p)
+            break;
+
+        if (*end == '-')
+            upper = strtoul(end + 1, &end, 10);
+
+        for (size_t i = lower; i <= upper; i++)
+            items.push_back(i);
+
+        p = *end == ',' ? end + 1 : end;
+    }
+
+    return items;
+}
+
+namespace FastRegExp
+{
+namespace Pages
+{
+struct Topology
+{
+    size_t nodes = 1;
+    std::vector<size_t> cpus;       /* node of each CPU */
+};
+
+static Topology discover(void)
+{
+    Topology topology;
+
+    for (size_t node : readList("/sys/devices/system/node/online"))
+    {
+        topology.nodes = std::max(topology.nodes, node + 1);
+
+        for (size_t cpu : readList("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist"))
+        {
+            if (cpu >= topology.cpus.size())
+                topology.cpus.resize(cpu + 1, 0);
+
+            topology.cpus[cpu] = node;
+        }
+    }
+
+    return topology;
+}
+
+static const Topology &topology(void)
+{
+    static const Topology topology = discover();
+    return topology;
+}
+
+static std::atomic<int> &current(void)
+{
+    static std::atomic<int> policy([]
+    {
+        /* the override applies before anything gets mapped */
+        if (const char *name = getenv("FASTREGEXP_PAGES"))
+            for (int i = static_cast<int>(Policy::PolicyNormal); i <= static_cast<int>(Policy::PolicyExplicit); i++)
+                if (!strcmp(name, nameOf(static_cast<Policy>(i))))
+                    return i;
+
+        return static_cast<int>(Policy::PolicyNormal);
+    }());
+
+    return policy;
+}
+
+Policy policy(void)
+{
+    return static_cast<Policy>(current().load(std::memory_order_relaxed));
+}
+
+void setPolicy(Policy policy)
+{
+    current().store(static_cast<int>(policy), std::memory_order_relaxed);
+}
+
+const char *nameOf(Policy policy)
+{
+    switch (policy)
+    {
+        case Policy::PolicyNormal      : return "normal";
+        case Policy::PolicyTransparent : return "transparent";
+        default                        : return "explicit";
+    }
+}
+
+size_t nodes(void)
+{
+    return topology().nodes;
+}
+
+size_t currentNode(void)
+{
+    static thread_local ssize_t node = -1;
+
+    if (node < 0)
+    {
+        int cpu = sched_getcpu();
+        const Topology &nodes = topology();
+
+        node = cpu >= 0 && static_cast<size_t>(cpu) < nodes.cpus.size() ? nodes.cpus[cpu] : 0;
+    }
+
+    return static_cast<size_t>(node);
+}
+
+/* a preference only, pages come from other nodes once this one runs out */
+static void prefer(void *addr, size_t size, size_t node)
+{
+#if defined(__linux__) && defined(SYS_mbind)
+    static const size_t Bits = sizeof(unsigned long) * 8;
+    std::vector<unsigned long> mask(node / Bits + 1, 0);
+
+    mask[node / Bits] |= 1ul << (node % Bits);
+    syscall(SYS_mbind, addr, size, PreferredPolicy, mask.data(), mask.size() * Bits + 1, 0);
+#else
+    (void)addr;
+    (void)size;
+    (void)node;
+#endif
+}
+
+bool advise(void *addr, size_t size)
+{
+#ifdef MADV_HUGEPAGE
+    return madvise(addr, size, MADV_HUGEPAGE) == 0;
+#else
+    (void)addr;
+    (void)size;
+    return false;
+#endif
+}
+
+void *map(size_t size, Policy policy, ssize_t node, size_t &mapped)
+{
+    void *addr = MAP_FAILED;
+    size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+    size = std::max(size, static_cast<size_t>(1));
+
+#ifdef MAP_HUGETLB
+    /* fails when the reserved pool is empty or was never set up */
+    if (policy == Policy::PolicyExplicit)
+    {
+        mapped = roundUp(size, HugePageSize);
+        addr = mmap(nullptr, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    }
+#endif
+
+    if (addr == MAP_FAILED && policy != Policy::PolicyNormal)
+    {
+        /* mapped with room to spare, then trimmed so the kernel can use whole huge pages from the start */
+        mapped = roundUp(size, HugePageSize);
+        void *mem = mmap(nullptr, mapped + HugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (mem != MAP_FAILED)
+        {
+            uintptr_t base = reinterpret_cast<uintptr_t>(mem);
+            uintptr_t aligned = roundUp(base, HugePageSize);
+
+            if (aligned > base)
+                munmap(mem, aligned - base);
+
+            if (aligned + mapped < base + mapped + HugePageSize)
+                munmap(reinterpret_cast<void *>(aligned + mapped), base + HugePageSize - aligned);
+
+            /* regular pages still work if refused */
+            addr = reinterpret_cast<void *>(aligned);
+            advise(addr, mapped);
+        }
+    }
+
+    if (addr == MAP_FAILED)
+    {
+        mapped = roundUp(size, page);
+        addr = mmap(nullptr, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    }
+
+    if (addr == MAP_FAILED)
+        return nullptr;
+
+    /* nothing was touched yet, so every page is placed by the preference */
+    if (node >= 0 && nodes() > 1)
+        prefer(addr, mapped, static_cast<size_t>(node));
+
+    return addr;
+}
+
+void unmap(void *addr, size_t mapped)
+{
+    munmap(addr, mapped);
+}
+}
+}
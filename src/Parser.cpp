@@ -32,114 +32,147 @@ size_t Parser::parseInt(void)
     return x;
 }
 
-std::shared_ptr<AST::RegExp> Parser::parseRegExp(char32_t delim)
+void Parser::skipExtended(void)
 {
-    char32_t ch;
-    std::shared_ptr<AST::RegExp> result = AST::Node::create<AST::RegExp>(_pos);
+    if (!(_flags & AST::Flags::FlagExtended))
+        return;
 
     for (;;)
     {
-        /* parse one section */
-        result->sections.push_back(parseSection(delim));
-
-        /* splitted by '|' or custom delimeter */
-        switch ((ch = peek()))
+        switch (peek())
         {
-            case 0:
-                return result;
-
-            case U'|':
+            case U' ':
+            case U'\t':
+            case U'\n':
+            case U'\v':
+            case U'\f':
+            case U'\r':
             {
                 next();
                 break;
             }
 
-            default:
+            case U'#':
             {
-                if (ch != delim)
-                    break;
-                else
-                    return result;
+                while (peek() != 0 && next() != U'\n');
+                break;
             }
+
+            default:
+                return;
         }
     }
 }
 
-std::shared_ptr<AST::Section> Parser::parseSection(char32_t delim)
+std::shared_ptr<AST::RegExp> Parser::parseRegExp(char32_t delim)
 {
     char32_t ch;
-    std::shared_ptr<AST::Section> result = AST::Node::create<AST::Section>(_pos);
+    std::vector<Frame> stack;
+
+    /* groups are parsed with an explicit stack, so nesting depth is not limited by the call stack */
+    stack.push_back({ delim, _flags, nullptr, AST::Node::create<AST::RegExp>(_pos), AST::Node::create<AST::Section>(_pos), {} });
 
     for (;;)
     {
-        /* splitted by '|' or custom delimeter */
-        switch ((ch = peek()))
+        /* white spaces and comments in extended mode */
+        skipExtended();
+
+        /* one element of the current section */
+        if ((ch = peek()) != 0 && ch != U'|' && ch != stack.back().delim)
         {
-            case 0:
-            case U'|':
-                return result;
+            std::shared_ptr<AST::Elementry> result = AST::Node::create<AST::Elementry>(_pos);
+            result->flags = _flags;
 
-            default:
+            switch (ch)
             {
-                if (ch == delim)
-                    return result;
+                case U'.': { next(); result->type = AST::Elementry::Type::ElementryAny          ; break; }
+                case U'$': { next(); result->type = AST::Elementry::Type::ElementryEndOfString  ; break; }
+                case U'^': { next(); result->type = AST::Elementry::Type::ElementryStartOfString; break; }
 
-                /* parse one element */
-                result->elements.push_back(parseElementry());
-                break;
-            }
-        }
-    }
-}
+                case U'[':
+                {
+                    result->type = AST::Elementry::Type::ElementryRange;
+                    result->range = parseRange();
+                    break;
+                }
 
-std::shared_ptr<AST::Elementry> Parser::parseElementry(void)
-{
-    std::shared_ptr<AST::Elementry> result = AST::Node::create<AST::Elementry>(_pos);
+                case U'(':
+                {
+                    int flags = _flags;
+                    std::u32string name;
 
-    switch (peek())
-    {
-        case U'.': { next(); result->type = AST::Elementry::Type::ElementryAny          ; break; }
-        case U'$': { next(); result->type = AST::Elementry::Type::ElementryEndOfString  ; break; }
-        case U'^': { next(); result->type = AST::Elementry::Type::ElementryStartOfString; break; }
+                    result->type = AST::Elementry::Type::ElementrySubExpr;
+                    result->subexpr = AST::Node::create<AST::SubExpr>(_pos);
 
-        case U'[':
-        {
-            result->type = AST::Elementry::Type::ElementryRange;
-            result->range = parseRange();
-            break;
-        }
+                    /* the element is finished when the body of the group ends */
+                    if (parseSubExpr(*result->subexpr, flags, name))
+                    {
+                        stack.push_back({ U')', flags, result, AST::Node::create<AST::RegExp>(_pos), AST::Node::create<AST::Section>(_pos), std::move(name) });
+                        continue;
+                    }
 
-        case U'(':
-        {
-            result->type = AST::Elementry::Type::ElementrySubExpr;
-            result->subexpr = parseSubExpr();
-            break;
+                    closeSubExpr(*result->subexpr, flags, name);
+                    break;
+                }
+
+                default:
+                {
+                    result->type = AST::Elementry::Type::ElementryCharacter;
+                    result->character = parseCharacter();
+                    break;
+                }
+            }
+
+            parseModifier(*result);
+            stack.back().section->elements.push_back(std::move(result));
+            continue;
         }
 
-        default:
+        /* splitted by '|' or custom delimeter */
+        stack.back().regexp->sections.push_back(std::move(stack.back().section));
+
+        if (ch == U'|')
         {
-            result->type = AST::Elementry::Type::ElementryCharacter;
-            result->character = parseCharacter();
-            break;
+            next();
+            stack.back().section = AST::Node::create<AST::Section>(_pos);
+            continue;
         }
+
+        if (stack.size() == 1)
+            return std::move(stack.back().regexp);
+
+        /* end of a group body */
+        Frame frame = std::move(stack.back());
+        stack.pop_back();
+
+        frame.owner->subexpr->expr = std::move(frame.regexp);
+        closeSubExpr(*frame.owner->subexpr, frame.flags, frame.name);
+        parseModifier(*frame.owner);
+        stack.back().section->elements.push_back(std::move(frame.owner));
     }
+}
+
+void Parser::parseModifier(AST::Elementry &result)
+{
+    /* modifiers may be separated in extended mode */
+    skipExtended();
 
     switch (peek())
     {
-        case U'+': { next(); result->modifier.type = AST::Elementry::Modifier::Type::ModifierPlus    ; break; }
-        case U'*': { next(); result->modifier.type = AST::Elementry::Modifier::Type::ModifierStar    ; break; }
-        case U'?': { next(); result->modifier.type = AST::Elementry::Modifier::Type::ModifierQuestion; break; }
+        case U'+': { next(); result.modifier.type = AST::Elementry::Modifier::Type::ModifierPlus    ; break; }
+        case U'*': { next(); result.modifier.type = AST::Elementry::Modifier::Type::ModifierStar    ; break; }
+        case U'?': { next(); result.modifier.type = AST::Elementry::Modifier::Type::ModifierQuestion; break; }
 
         case U'{':
         {
             next();
-            result->modifier.type = AST::Elementry::Modifier::Type::ModifierRepeat;
-            result->modifier.lower = parseInt();
+            result.modifier.type = AST::Elementry::Modifier::Type::ModifierRepeat;
+            result.modifier.lower = parseInt();
 
             if (!skipIf<U','>())
-                result->modifier.upper = result->modifier.lower;
+                result.modifier.upper = result.modifier.lower;
             else if (peek() != U'}')
-                result->modifier.upper = parseInt();
+                result.modifier.upper = parseInt();
 
             if (next() != U'}')
                 throw SyntaxError(_pos, "'}' expected");
@@ -151,10 +184,8 @@ std::shared_ptr<AST::Elementry> Parser::parseElementry(void)
             break;
     }
 
-    if (result->modifier.type != AST::Elementry::Modifier::Type::ModifierNone)
-        result->modifier.isLazy = skipIf<U'?'>();
-
-    return result;
+    if (result.modifier.type != AST::Elementry::Modifier::Type::ModifierNone)
+        result.modifier.isLazy = skipIf<U'?'>();
 }
 
 std::shared_ptr<AST::Range> Parser::parseRange(void)
@@ -201,19 +232,17 @@ std::shared_ptr<AST::Range> Parser::parseRange(void)
     return result;
 }
 
-std::shared_ptr<AST::SubExpr> Parser::parseSubExpr(void)
+bool Parser::parseSubExpr(AST::SubExpr &result, int &flags, std::u32string &name)
 {
     char32_t ch;
-    std::shared_ptr<AST::SubExpr> result = AST::Node::create<AST::SubExpr>(_pos);
 
     if (next() != U'(')
         throw SyntaxError(_pos, "'(' expected");
 
     if (!skipIf<U'?'>())
     {
-        result->type = AST::SubExpr::Type::SubExprSimple;
-        result->expr = parseRegExp(U')');
-        _groups.push_back(result->expr);
+        result.type = AST::SubExpr::Type::SubExprSimple;
+        return true;
     }
     else
     {
@@ -224,23 +253,81 @@ std::shared_ptr<AST::SubExpr> Parser::parseSubExpr(void)
 
             case U':':
             {
-                result->type = AST::SubExpr::Type::SubExprNonCapture;
-                result->expr = parseRegExp(U')');
+                result.type = AST::SubExpr::Type::SubExprNonCapture;
+                return true;
+            }
+
+            case U'i':
+            case U'm':
+            case U's':
+            case U'x':
+            case U'-':
+            {
+                int bit = 0;
+                bool negate = false;
+
+                for (;; ch = next())
+                {
+                    switch (ch)
+                    {
+                        case U'i': bit = AST::Flags::FlagIgnoreCase; break;
+                        case U'm': bit = AST::Flags::FlagMultiLine ; break;
+                        case U's': bit = AST::Flags::FlagDotAll    ; break;
+                        case U'x': bit = AST::Flags::FlagExtended  ; break;
+
+                        case U'-':
+                        {
+                            if (negate)
+                                throw SyntaxError(_pos, "Duplicated '-' in flags");
+
+                            negate = true;
+                            continue;
+                        }
+
+                        /* scoped flags, only applies to the group */
+                        case U':':
+                        {
+                            std::swap(flags, _flags);
+                            result.type = AST::SubExpr::Type::SubExprNonCapture;
+                            return true;
+                        }
+
+                        /* inline flags, applies to the rest of the enclosing group */
+                        case U')':
+                        {
+                            _pos--;
+                            result.type = AST::SubExpr::Type::SubExprNonCapture;
+                            result.expr = AST::Node::create<AST::RegExp>(_pos);
+                            result.expr->sections.push_back(AST::Node::create<AST::Section>(_pos));
+                            break;
+                        }
+
+                        default:
+                            throw SyntaxError(_pos, "Unknown flag '" + Unicode::toString(ch) + "'");
+                    }
+
+                    if (ch == U':' || ch == U')')
+                        break;
+
+                    if (negate)
+                        flags &= ~bit;
+                    else
+                        flags |= bit;
+                }
+
                 break;
             }
 
             case U'=':
             {
-                result->type = AST::SubExpr::Type::SubExprPositiveLookahead;
-                result->expr = parseRegExp(U')');
-                break;
+                result.type = AST::SubExpr::Type::SubExprPositiveLookahead;
+                return true;
             }
 
             case U'!':
             {
-                result->type = AST::SubExpr::Type::SubExprNegativeLookahead;
-                result->expr = parseRegExp(U')');
-                break;
+                result.type = AST::SubExpr::Type::SubExprNegativeLookahead;
+                return true;
             }
 
             case U'&':
@@ -257,8 +344,8 @@ std::shared_ptr<AST::SubExpr> Parser::parseSubExpr(void)
                 if ((iter = _namedGroups.find(name)) == _namedGroups.end())
                     throw SyntaxError(_pos, "No such group named '" + Unicode::toString(name) + "'");
 
-                result->expr = iter->second;
-                result->type = AST::SubExpr::Type::SubExprReference;
+                result.expr = iter->second;
+                result.type = AST::SubExpr::Type::SubExprReference;
                 break;
             }
 
@@ -275,8 +362,8 @@ std::shared_ptr<AST::SubExpr> Parser::parseSubExpr(void)
                 if (index > _groups.size())
                     throw SyntaxError(_pos, "Invalid group number " + std::to_string(index));
 
-                result->expr = _groups[index - 1];
-                result->type = AST::SubExpr::Type::SubExprReference;
+                result.expr = _groups[index - 1];
+                result.type = AST::SubExpr::Type::SubExprReference;
                 break;
             }
 
@@ -286,16 +373,14 @@ std::shared_ptr<AST::SubExpr> Parser::parseSubExpr(void)
                 {
                     case U'=':
                     {
-                        result->type = AST::SubExpr::Type::SubExprPositiveLookbehind;
-                        result->expr = parseRegExp(U')');
-                        break;
+                        result.type = AST::SubExpr::Type::SubExprPositiveLookbehind;
+                        return true;
                     }
 
                     case U'!':
                     {
-                        result->type = AST::SubExpr::Type::SubExprNegativeLookbehind;
-                        result->expr = parseRegExp(U')');
-                        break;
+                        result.type = AST::SubExpr::Type::SubExprNegativeLookbehind;
+                        return true;
                     }
 
                     default:
@@ -323,15 +408,14 @@ std::shared_ptr<AST::SubExpr> Parser::parseSubExpr(void)
                         if ((iter = _namedGroups.find(name)) == _namedGroups.end())
                             throw SyntaxError(_pos, "No such group named '" + Unicode::toString(name) + "'");
 
-                        result->name = iter->first;
-                        result->type = AST::SubExpr::Type::SubExprMatchName;
+                        result.name = iter->first;
+                        result.type = AST::SubExpr::Type::SubExprMatchName;
                         break;
                     }
 
                     case U'<':
                     {
                         char32_t c;
-                        std::u32string name;
 
                         while ((c = next()) != U'>')
                             name += c;
@@ -342,12 +426,8 @@ std::shared_ptr<AST::SubExpr> Parser::parseSubExpr(void)
                         if (_namedGroups.find(name) != _namedGroups.end())
                             throw SyntaxError(_pos, "Duplicated group name '" + Unicode::toString(name) + "'");
 
-                        result->type = AST::SubExpr::Type::SubExprSimple;
-                        result->expr = parseRegExp(U')');
-
-                        _groups.push_back(result->expr);
-                        _namedGroups.emplace(std::move(name), result->expr);
-                        break;
+                        result.type = AST::SubExpr::Type::SubExprSimple;
+                        return true;
                     }
 
                     default:
@@ -362,10 +442,25 @@ std::shared_ptr<AST::SubExpr> Parser::parseSubExpr(void)
         }
     }
 
+    return false;
+}
+
+void Parser::closeSubExpr(AST::SubExpr &result, int flags, std::u32string &name)
+{
     if (next() != U')')
         throw SyntaxError(_pos, "')' expected");
 
-    return result;
+    /* groups are numbered when they are closed */
+    if (result.type == AST::SubExpr::Type::SubExprSimple)
+    {
+        _groups.push_back(result.expr);
+
+        if (!name.empty())
+            _namedGroups.emplace(std::move(name), result.expr);
+    }
+
+    /* flags changed inside the group are restored, inline flags are kept */
+    _flags = flags;
 }
 
 std::shared_ptr<AST::Character> Parser::parseCharacter(void)
@@ -398,6 +493,46 @@ std::shared_ptr<AST::Character> Parser::parseCharacter(void)
             case U'S': result->type = AST::Character::Type::CharacterNonSpace ; break;
             case U'B': result->type = AST::Character::Type::CharacterNonBorder; break;
 
+            case U'p':
+            case U'P':
+            {
+                std::vector<std::pair<char32_t, char32_t>> ranges;
+
+                result->type = (ch == U'p') ? AST::Character::Type::CharacterProperty : AST::Character::Type::CharacterNonProperty;
+
+                /* single letter categories may leave out the braces */
+                if (!skipIf<U'{'>())
+                {
+                    if ((ch = next()) == 0)
+                        throw SyntaxError(_pos, "\"EOF\" when parsing property name");
+
+                    result->name = ch;
+                }
+                else
+                {
+                    while ((ch = next()) != U'}')
+                    {
+                        if (ch == 0)
+                            throw SyntaxError(_pos, "\"EOF\" when parsing property name");
+
+                        result->name += ch;
+                    }
+                }
+
+                /* `\p{^...}` is the same as `\P{...}` */
+                if (!result->name.empty() && result->name[0] == U'^')
+                {
+                    result->name.erase(0, 1);
+                    result->type = (result->type == AST::Character::Type::CharacterProperty) ?
+                        AST::Character::Type::CharacterNonProperty : AST::Character::Type::CharacterProperty;
+                }
+
+                if (!Unicode::propertyRanges(result->name, ranges))
+                    throw SyntaxError(_pos, "Unknown property '" + Unicode::toString(result->name) + "'");
+
+                break;
+            }
+
             case U'n': { result->type = AST::Character::Type::CharacterSimple; result->character = U'\n'; break; }
             case U'r': { result->type = AST::Character::Type::CharacterSimple; result->character = U'\r'; break; }
             case U't': { result->type = AST::Character::Type::CharacterSimple; result->character = U'\t'; break; }
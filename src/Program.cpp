@@ -0,0 +1,386 @@
+#include <iomanip>
+#include <sstream>
+#include <algorithm>
+
+#include "Program.h"
+
+static inline std::string byte(unsigned int ch)
+{
+    std::stringstream stream;
+
+    if (ch >= 0x20 && ch < 0x7f && ch != '\\' && ch != '-' && ch != ']')
+        stream << static_cast<char>(ch);
+    else
+        stream << "\\x" << std::setfill('0') << std::setw(2) << std::hex << ch;
+
+    return stream.str();
+}
+
+static inline std::string bound(ssize_t upper)
+{
+    return upper < 0 ? "Inf" : std::to_string(upper);
+}
+
+static inline std::string literal(const FastRegExp::Literal &literal)
+{
+    std::string result = "\"";
+
+    for (size_t i = 0; i < literal.bytes.size(); i++)
+    {
+        if (!literal.masks[i])
+            result += byte(static_cast<uint8_t>(literal.bytes[i]));
+        else
+            result += "(?i:" + byte(static_cast<uint8_t>(literal.bytes[i])) + ")";
+    }
+
+    return result + "\"";
+}
+
+namespace FastRegExp
+{
+std::string ByteSet::toString(void) const
+{
+    std::string result = "[";
+
+    for (unsigned int ch = 0; ch < 256; ch++)
+    {
+        if (!test(static_cast<uint8_t>(ch)))
+            continue;
+
+        unsigned int end = ch;
+        while (end < 255 && test(static_cast<uint8_t>(end + 1)))
+            end++;
+
+        result += byte(ch);
+
+        if (end != ch)
+        {
+            result += "-";
+            result += byte(end);
+        }
+
+        ch = end;
+    }
+
+    return result + "]";
+}
+
+std::string Program::toString(void) const
+{
+    std::string result;
+
+    for (size_t pc = 0; pc < code.size(); pc++)
+    {
+        const Instruction &ins = code[pc];
+        result += std::to_string(pc) + "\t";
+
+        switch (ins.opcode)
+        {
+            case Instruction::Opcode::OpcodeSet         : result += "Set " + sets[ins.index].toString(); break;
+            case Instruction::Opcode::OpcodeByte        : result += "Byte " + byte(static_cast<unsigned int>(ins.index)); break;
+            case Instruction::Opcode::OpcodeJump        : result += "Jump " + std::to_string(ins.x); break;
+            case Instruction::Opcode::OpcodeMark        : result += "Mark r" + std::to_string(ins.index); break;
+            case Instruction::Opcode::OpcodeSave        : result += "Save " + std::to_string(ins.index); break;
+            case Instruction::Opcode::OpcodeMatch       : result += "Match"; break;
+            case Instruction::Opcode::OpcodeSplit       : result += "Split " + std::to_string(ins.x) + ", " + std::to_string(ins.y); break;
+            case Instruction::Opcode::OpcodeBackref     : result += (ins.isCaseless ? "Backref Caseless " : "Backref ") + std::to_string(ins.index); break;
+            case Instruction::Opcode::OpcodeCounterInit : result += "CounterInit r" + std::to_string(ins.index); break;
+            case Instruction::Opcode::OpcodeCounterIncr : result += "CounterIncr r" + std::to_string(ins.index); break;
+
+            case Instruction::Opcode::OpcodeAssert:
+            {
+                switch (static_cast<Instruction::Assertion>(ins.index))
+                {
+                    case Instruction::Assertion::AssertionWordBorder     : result += "Assert WordBorder"    ; break;
+                    case Instruction::Assertion::AssertionNonWordBorder  : result += "Assert NonWordBorder" ; break;
+                    case Instruction::Assertion::AssertionEndOfLine      : result += "Assert EndOfLine"     ; break;
+                    case Instruction::Assertion::AssertionStartOfLine    : result += "Assert StartOfLine"   ; break;
+                    case Instruction::Assertion::AssertionEndOfString    : result += "Assert EndOfString"   ; break;
+                    case Instruction::Assertion::AssertionStartOfString  : result += "Assert StartOfString" ; break;
+                }
+
+                break;
+            }
+
+            case Instruction::Opcode::OpcodeLiteral:
+            {
+                result += "Literal " + literal(literals[ins.index]);
+                break;
+            }
+
+            case Instruction::Opcode::OpcodeLookEnd:
+            {
+                result += ins.isBehind ? "LookEnd r" + std::to_string(ins.index) : "LookEnd";
+                break;
+            }
+
+            case Instruction::Opcode::OpcodeLookSets:
+            {
+                result += "LookSets";
+                result += ins.isBehind ? " Behind" : " Ahead";
+                result += ins.isNegative ? " Negative " : " ";
+
+                for (size_t set : sequences[ins.index])
+                    result += sets[set].toString();
+
+                break;
+            }
+
+            case Instruction::Opcode::OpcodeLookLiteral:
+            {
+                result += "LookLiteral";
+                result += ins.isBehind ? " Behind" : " Ahead";
+                result += ins.isNegative ? " Negative " : " ";
+                result += literal(literals[ins.index]);
+                break;
+            }
+
+            case Instruction::Opcode::OpcodeLookaround:
+            {
+                result += "Lookaround";
+                result += ins.isBehind ? " Behind" : " Ahead";
+                result += ins.isNegative ? " Negative " : " ";
+                result += std::to_string(ins.x) + ", " + std::to_string(ins.y);
+
+                if (ins.isBehind)
+                    result += ", r" + std::to_string(ins.index) + " {" + std::to_string(ins.lower) + ", " + bound(ins.upper) + "}";
+
+                break;
+            }
+
+            case Instruction::Opcode::OpcodeRepeatSet:
+            {
+                result += ins.isLazy ? "RepeatSet Lazy " : "RepeatSet ";
+                result += ins.isWhole ? "Whole " : "";
+                result += sets[ins.index].toString();
+                result += " {" + std::to_string(ins.lower) + ", " + bound(ins.upper) + "}";
+                break;
+            }
+
+            case Instruction::Opcode::OpcodeProgress:
+            {
+                result += "Progress r" + std::to_string(ins.index) + ", " + std::to_string(ins.x);
+
+                if (ins.y)
+                    result += ", r" + std::to_string(ins.y - 1) + " >= " + std::to_string(ins.lower);
+
+                break;
+            }
+
+            case Instruction::Opcode::OpcodeCounterLoop:
+            {
+                result += ins.isLazy ? "CounterLoop Lazy r" : "CounterLoop r";
+                result += std::to_string(ins.index);
+                result += " {" + std::to_string(ins.lower) + ", " + bound(ins.upper) + "}, ";
+                result += std::to_string(ins.x) + ", " + std::to_string(ins.y);
+                break;
+            }
+        }
+
+        result += "\n";
+    }
+
+    return result;
+}
+
+static inline void shift(size_t &value, ssize_t offset)
+{
+    value = static_cast<size_t>(static_cast<ssize_t>(value) + offset);
+}
+
+void Relocation::apply(Instruction &ins) const
+{
+    switch (ins.opcode)
+    {
+        case Instruction::Opcode::OpcodeSet         : ins.index = sets[ins.index]; break;
+        case Instruction::Opcode::OpcodeRepeatSet   : ins.index = sets[ins.index]; break;
+        case Instruction::Opcode::OpcodeLiteral     : shift(ins.index, literals); break;
+        case Instruction::Opcode::OpcodeLookSets    : shift(ins.index, sequences); break;
+        case Instruction::Opcode::OpcodeLookLiteral : shift(ins.index, literals); break;
+        case Instruction::Opcode::OpcodeMark        : shift(ins.index, registers); break;
+        case Instruction::Opcode::OpcodeCounterInit : shift(ins.index, registers); break;
+        case Instruction::Opcode::OpcodeCounterIncr : shift(ins.index, registers); break;
+        case Instruction::Opcode::OpcodeJump        : shift(ins.x, code); break;
+
+        /* look-aheads have no register */
+        case Instruction::Opcode::OpcodeLookEnd:
+        {
+            if (ins.isBehind)
+                shift(ins.index, registers);
+
+            break;
+        }
+
+        case Instruction::Opcode::OpcodeSplit:
+        case Instruction::Opcode::OpcodeCounterLoop:
+        case Instruction::Opcode::OpcodeLookaround:
+        {
+            shift(ins.x, code);
+            shift(ins.y, code);
+
+            if (ins.opcode == Instruction::Opcode::OpcodeCounterLoop || ins.isBehind)
+                shift(ins.index, registers);
+
+            break;
+        }
+
+        /* `y` is a register here, off by one so 0 means none */
+        case Instruction::Opcode::OpcodeProgress:
+        {
+            shift(ins.x, code);
+            shift(ins.index, registers);
+
+            if (ins.y)
+                shift(ins.y, registers);
+
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+void Relocation::apply(std::vector<size_t> &sequence) const
+{
+    for (size_t &set : sequence)
+        set = sets[set];
+}
+
+Program Program::alternate(const std::vector<const Program *> &programs)
+{
+    Program result;
+
+    if (programs.empty())
+    {
+        /* matches nothing */
+        result.sets.emplace_back();
+        result.scanners.emplace_back(result.sets.back());
+        result.code.emplace_back(Instruction::Opcode::OpcodeSet, 0);
+        result.code.emplace_back(Instruction::Opcode::OpcodeMatch);
+        result.analysis.minLength = 1;
+        result.analysis.maxLength = 1;
+        return result;
+    }
+
+    /* a chain of splits in front, one for each alternative but the last */
+    for (size_t i = 0; i + 1 < programs.size(); i++)
+    {
+        result.code.emplace_back(Instruction::Opcode::OpcodeSplit);
+        result.code.back().y = i + 1;
+    }
+
+    for (size_t i = 0; i < programs.size(); i++)
+    {
+        const Program &program = *programs[i];
+        size_t base = result.code.size();
+        Relocation relocation;
+
+        if (i + 1 < programs.size())
+            result.code[i].x = base;
+        else if (i)
+            result.code[i - 1].y = base;
+
+        relocation.code = static_cast<ssize_t>(base);
+        relocation.literals = static_cast<ssize_t>(result.literals.size());
+        relocation.sequences = static_cast<ssize_t>(result.sequences.size());
+        relocation.registers = static_cast<ssize_t>(result.registers);
+
+        /* classes repeated across the patterns are stored once */
+        for (size_t j = 0; j < program.sets.size(); j++)
+        {
+            auto iter = std::find(result.sets.begin(), result.sets.end(), program.sets[j]);
+            relocation.sets.push_back(static_cast<size_t>(iter - result.sets.begin()));
+
+            if (iter == result.sets.end())
+            {
+                result.sets.push_back(program.sets[j]);
+                result.scanners.push_back(program.scanners[j]);
+            }
+        }
+
+        for (Instruction ins : program.code)
+        {
+            relocation.apply(ins);
+            result.code.push_back(ins);
+        }
+
+        for (const std::vector<size_t> &sequence : program.sequences)
+        {
+            result.sequences.push_back(sequence);
+            relocation.apply(result.sequences.back());
+        }
+
+        result.literals.insert(result.literals.end(), program.literals.begin(), program.literals.end());
+        result.groups = std::max(result.groups, program.groups);
+        result.registers += program.registers;
+
+        /* the shortest and longest of the alternatives, anchored only if all of them are, the rest is unknown for the whole */
+        if (i == 0)
+        {
+            result.analysis.minLength = program.analysis.minLength;
+            result.analysis.maxLength = program.analysis.maxLength;
+            result.analysis.isAnchoredEnd = program.analysis.isAnchoredEnd;
+            result.analysis.isAnchoredStart = program.analysis.isAnchoredStart;
+        }
+        else
+        {
+            result.analysis.minLength = std::min(result.analysis.minLength, program.analysis.minLength);
+
+            if (result.analysis.maxLength >= 0)
+                result.analysis.maxLength = program.analysis.maxLength < 0 ? -1 : std::max(result.analysis.maxLength, program.analysis.maxLength);
+
+            result.analysis.isAnchoredEnd &= program.analysis.isAnchoredEnd;
+            result.analysis.isAnchoredStart &= program.analysis.isAnchoredStart;
+        }
+
+        result.analysis.hasBackrefs |= program.analysis.hasBackrefs;
+        result.analysis.hasLookarounds |= program.analysis.hasLookarounds;
+    }
+
+    return result;
+}
+
+Program Program::anchor(const Program &program, bool isFull)
+{
+    Program result = program;
+    Relocation relocation;
+
+    /* everything moves one instruction down, behind the start assertion */
+    relocation.code = 1;
+
+    for (size_t i = 0; i < program.sets.size(); i++)
+        relocation.sets.push_back(i);
+
+    result.code.clear();
+    result.code.emplace_back(Instruction::Opcode::OpcodeAssert, static_cast<size_t>(Instruction::Assertion::AssertionStartOfString));
+
+    for (Instruction ins : program.code)
+    {
+        relocation.apply(ins);
+        result.code.push_back(ins);
+    }
+
+    result.analysis.isAnchoredStart = true;
+
+    if (!isFull)
+        return result;
+
+    /* every match goes through the end assertion in the tail */
+    size_t tail = result.code.size();
+
+    for (Instruction &ins : result.code)
+    {
+        if (ins.opcode == Instruction::Opcode::OpcodeMatch)
+        {
+            ins = Instruction(Instruction::Opcode::OpcodeJump);
+            ins.x = tail;
+        }
+    }
+
+    result.code.emplace_back(Instruction::Opcode::OpcodeAssert, static_cast<size_t>(Instruction::Assertion::AssertionEndOfString));
+    result.code.emplace_back(Instruction::Opcode::OpcodeMatch);
+    result.analysis.isAnchoredEnd = true;
+    return result;
+}
+}
@@ -0,0 +1,287 @@
+#include <algorithm>
+
+#include "DFA.h"
+#include "Parser.h"
+#include "RegExp.h"
+#include "Compiler.h"
+#include "Backtracker.h"
+
+namespace FastRegExp
+{
+RegExp::RegExp(const std::string &regexp, int flags, Fragments *fragments)
+{
+    Parser parser(regexp, flags);
+    Compiler compiler(parser, fragments);
+    _program = compiler.compile(parser.parse());
+    _useDFA = DFA::isSupported(_program);
+
+    if ((flags & AST::Flags::FlagRejectRisky) && _program.analysis.isRisky())
+        throw SyntaxError(static_cast<size_t>(_program.analysis.riskPos), _program.analysis.risk);
+
+    /* small enough automatons are built ahead of time */
+    if (_useDFA)
+    {
+        _dense = std::make_shared<DenseDFA>();
+
+        if (!_dense->build(_program))
+            _dense.reset();
+    }
+
+    /* the anchored ones only when asked for */
+    if (!_program.analysis.isAnchoredStart)
+        _prefix = std::make_shared<Anchored>();
+
+    if (!_program.analysis.isAnchoredStart || !_program.analysis.isAnchoredEnd)
+        _full = std::make_shared<Anchored>();
+}
+
+bool RegExp::mayMatch(DFA &dfa, const char *str, size_t len, size_t start, Budget *budget) const
+{
+    return mayMatch(dfa, _dense.get(), str, len, start, budget);
+}
+
+bool RegExp::mayMatch(DFA &dfa, const DenseDFA *dense, const char *str, size_t len, size_t start, Budget *budget) const
+{
+    if (len - start < _program.analysis.minLength)
+        return false;
+
+    if (dense)
+        return dense->exec(str, len, start, budget);
+    else
+        return !_useDFA || dfa.exec(str, len, start);
+}
+
+Budget::Result RegExp::match(const char *str, size_t len, size_t start, std::vector<ssize_t> *slots, Budget *budget) const
+{
+    return match(_program, _dense.get(), str, len, start, slots, budget);
+}
+
+Budget::Result RegExp::match(const Program &program, const DenseDFA *dense, const char *str, size_t len, size_t start, std::vector<ssize_t> *slots, Budget *budget) const
+{
+    if (start > len)
+        return Budget::Result::ResultNoMatch;
+
+    /* rejecting with the DFA first avoids backtracking on inputs that never match, and when no captures
+     * are wanted it's answer is final */
+    DFA dfa(program, budget);
+    bool found = mayMatch(dfa, dense, str, len, start, budget);
+
+    if (budget && budget->isExceeded())
+        return Budget::Result::ResultExceeded;
+
+    if (!found)
+        return Budget::Result::ResultNoMatch;
+
+    if (!slots && _useDFA)
+        return Budget::Result::ResultMatch;
+
+    Backtracker matcher(program, budget);
+
+    if (!matcher.exec(str, len, start))
+    {
+        if (budget && budget->isExceeded())
+            return Budget::Result::ResultExceeded;
+        else
+            return Budget::Result::ResultNoMatch;
+    }
+
+    if (slots)
+        *slots = matcher.slots();
+
+    return Budget::Result::ResultMatch;
+}
+
+bool RegExp::matchAnchored(const std::string &str, std::vector<ssize_t> *slots, bool isFull) const
+{
+    Anchored *anchored = isFull ? _full.get() : _prefix.get();
+
+    /* patterns anchored on their own already match only that way */
+    if (!anchored)
+        return match(str.data(), str.size(), 0, slots, nullptr) == Budget::Result::ResultMatch;
+
+    std::call_once(anchored->once, [&](void)
+    {
+        anchored->program = Program::anchor(_program, isFull);
+
+        if (_useDFA)
+        {
+            anchored->dense = std::make_shared<DenseDFA>();
+
+            if (!anchored->dense->build(anchored->program))
+                anchored->dense.reset();
+        }
+    });
+
+    return match(anchored->program, anchored->dense.get(), str.data(), str.size(), 0, slots, nullptr) == Budget::Result::ResultMatch;
+}
+
+bool RegExp::test(const std::string &str) const
+{
+    return match(str.data(), str.size(), 0, nullptr, nullptr) == Budget::Result::ResultMatch;
+}
+
+Budget::Result RegExp::test(const std::string &str, Budget &budget) const
+{
+    budget.reset();
+    return match(str.data(), str.size(), 0, nullptr, &budget);
+}
+
+bool RegExp::testParallel(const char *str, size_t len, size_t threads) const
+{
+    if (!_dense)
+        return match(str, len, 0, nullptr, nullptr) == Budget::Result::ResultMatch;
+
+    if (len < _program.analysis.minLength)
+        return false;
+
+    return _dense->execParallel(str, len, 0, threads);
+}
+
+template <typename String>
+void RegExp::batch(const String *strs, size_t count, uint64_t *out) const
+{
+    DFA dfa(_program);
+    Backtracker matcher(_program);
+
+    /* one output word at a time, so nothing is allocated per call */
+    for (size_t base = 0; base < count; base += 64)
+    {
+        bool results[64] = {};
+        size_t lens[64];
+        size_t indexes[64];
+        const char *ptrs[64];
+        size_t size = 0;
+        size_t limit = std::min(count - base, static_cast<size_t>(64));
+
+        /* inputs shorter than any match are left out */
+        for (size_t i = 0; i < limit; i++)
+        {
+            if (strs[base + i].size() >= _program.analysis.minLength)
+            {
+                ptrs[size] = strs[base + i].data();
+                lens[size] = strs[base + i].size();
+                indexes[size++] = i;
+            }
+        }
+
+        if (_dense)
+        {
+            _dense->execBatch(ptrs, lens, size, results);
+        }
+        else if (_useDFA)
+        {
+            dfa.execBatch(ptrs, lens, size, results);
+        }
+        else
+        {
+            for (size_t i = 0; i < size; i++)
+                results[i] = matcher.exec(ptrs[i], lens[i], 0);
+        }
+
+        out[base / 64] = 0;
+
+        for (size_t i = 0; i < size; i++)
+            out[base / 64] |= static_cast<uint64_t>(results[i]) << indexes[i];
+    }
+}
+
+void RegExp::matchBatch(const std::string *strs, size_t count, uint64_t *out) const
+{
+    batch(strs, count, out);
+}
+
+#if __cplusplus >= 201703L
+void RegExp::matchBatch(const std::string_view *strs, size_t count, uint64_t *out) const
+{
+    batch(strs, count, out);
+}
+#endif
+
+bool RegExp::search(const std::string &str, std::vector<ssize_t> &slots, size_t start) const
+{
+    return match(str.data(), str.size(), start, &slots, nullptr) == Budget::Result::ResultMatch;
+}
+
+Budget::Result RegExp::search(const std::string &str, std::vector<ssize_t> &slots, Budget &budget, size_t start) const
+{
+    budget.reset();
+    return match(str.data(), str.size(), start, &slots, &budget);
+}
+
+template <typename Callback>
+size_t RegExp::each(const char *str, size_t len, size_t limit, Budget *budget, Callback &&callback) const
+{
+    DFA dfa(_program, budget);
+    Backtracker matcher(_program, budget);
+
+    size_t pos = 0;
+    size_t count = 0;
+    bool isEmpty = false;
+
+    /* one budget for the whole call, the engines fail once it's exceeded and the loop ends there */
+    if (budget)
+        budget->reset();
+
+    while (pos <= len && (limit == 0 || count < limit))
+    {
+        if (!mayMatch(dfa, str, len, pos, budget))
+            break;
+
+        /* after an empty match only a non-empty one may start at the same position, so the search always moves
+         * forward */
+        if (!matcher.exec(str, len, pos, count != 0, isEmpty))
+            break;
+
+        const std::vector<ssize_t> &slots = matcher.slots();
+        callback(slots);
+        count++;
+
+        pos = slots[1];
+        isEmpty = slots[0] == slots[1];
+    }
+
+    return count;
+}
+
+size_t RegExp::findIter(const char *str, size_t len, std::vector<Span> &spans, size_t limit, Budget *budget) const
+{
+    spans.clear();
+    return each(str, len, limit, budget, [&](const std::vector<ssize_t> &slots)
+    {
+        for (size_t i = 0; i <= _program.groups; i++)
+            spans.push_back({ slots[i * 2], slots[i * 2 + 1] });
+    });
+}
+
+size_t RegExp::split(const char *str, size_t len, std::vector<Span> &pieces, size_t limit, Budget *budget) const
+{
+    ssize_t last = 0;
+
+    pieces.clear();
+    each(str, len, limit, budget, [&](const std::vector<ssize_t> &slots)
+    {
+        pieces.push_back({ last, slots[0] });
+        last = slots[1];
+    });
+
+    pieces.push_back({ last, static_cast<ssize_t>(len) });
+    return pieces.size();
+}
+
+size_t RegExp::replace(const char *str, size_t len, const Substitution &substitution, std::string &out, size_t limit, Budget *budget) const
+{
+    size_t last = 0;
+    size_t count;
+
+    out.clear();
+    count = each(str, len, limit, budget, [&](const std::vector<ssize_t> &slots)
+    {
+        out.append(str + last, slots[0] - last);
+        substitution.expand(str, slots, out);
+        last = slots[1];
+    });
+
+    out.append(str + last, len - last);
+    return count;
+}
+}
@@ -0,0 +1,232 @@
+#include <algorithm>
+
+#include "DFA.h"
+#include "RegExpSet.h"
+
+namespace FastRegExp
+{
+RegExpSet::RegExpSet(size_t shardSize) :
+    _shardSize(std::max(shardSize, static_cast<size_t>(1))), _snapshot(std::make_shared<const Snapshot>()) {}
+
+std::shared_ptr<const RegExpSet::Snapshot> RegExpSet::load(void) const
+{
+#if defined(__cpp_lib_atomic_shared_ptr)
+    return _snapshot.load();
+#else
+    return std::atomic_load(&_snapshot);
+#endif
+}
+
+bool RegExpSet::united(const Shard &shard, const std::string &str)
+{
+    if (shard.united.empty() || str.size() < shard.program.analysis.minLength)
+        return false;
+
+    if (shard.dense)
+        return shard.dense->exec(str.data(), str.size(), 0);
+
+    DFA dfa(shard.program);
+    return dfa.exec(str.data(), str.size(), 0);
+}
+
+std::shared_ptr<const RegExpSet::Shard> RegExpSet::build(std::vector<size_t> &&ids, std::vector<std::shared_ptr<const RegExp>> &&patterns)
+{
+    std::vector<const Program *> programs;
+    std::shared_ptr<Shard> shard = std::make_shared<Shard>();
+
+    shard->ids = std::move(ids);
+    shard->patterns = std::move(patterns);
+
+    for (size_t i = 0; i < shard->patterns.size(); i++)
+    {
+        if (DFA::isSupported(shard->patterns[i]->program()))
+            shard->united.push_back(i);
+        else
+            shard->others.push_back(i);
+    }
+
+    /* a single pattern gains nothing from going through the alternation first */
+    if (shard->united.size() == 1)
+    {
+        shard->others.push_back(shard->united[0]);
+        shard->united.clear();
+        std::sort(shard->others.begin(), shard->others.end());
+    }
+
+    if (shard->united.empty())
+        return shard;
+
+    for (size_t i : shard->united)
+        programs.push_back(&shard->patterns[i]->program());
+
+    shard->program = Program::alternate(programs);
+    shard->dense = std::make_shared<DenseDFA>();
+
+    if (!shard->dense->build(shard->program))
+        shard->dense.reset();
+
+    return shard;
+}
+
+void RegExpSet::update(std::vector<std::shared_ptr<const RegExp>> &&added, const std::vector<size_t> &removed, std::vector<size_t> &ids, size_t &count)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::shared_ptr<const Snapshot> current = load();
+    std::shared_ptr<Snapshot> next = std::make_shared<Snapshot>(*current);
+
+    /* shards are copied out the first time they change, the others are shared with the current snapshot */
+    std::vector<bool> touched(next->shards.size(), false);
+    std::vector<std::vector<size_t>> pendingIds(next->shards.size());
+    std::vector<std::vector<std::shared_ptr<const RegExp>>> pendingPatterns(next->shards.size());
+
+    auto touch = [&](size_t i)
+    {
+        if (!touched[i])
+        {
+            touched[i] = true;
+            pendingIds[i] = next->shards[i]->ids;
+            pendingPatterns[i] = next->shards[i]->patterns;
+        }
+    };
+
+    count = 0;
+    ids.clear();
+
+    /* ids only grow, so they stay sorted within each shard */
+    for (size_t id : removed)
+    {
+        for (size_t i = 0; i < next->shards.size(); i++)
+        {
+            const std::vector<size_t> &list = touched[i] ? pendingIds[i] : next->shards[i]->ids;
+            auto it = std::lower_bound(list.begin(), list.end(), id);
+
+            if (it == list.end() || *it != id)
+                continue;
+
+            size_t index = static_cast<size_t>(it - list.begin());
+
+            touch(i);
+            pendingIds[i].erase(pendingIds[i].begin() + index);
+            pendingPatterns[i].erase(pendingPatterns[i].begin() + index);
+            count++;
+            break;
+        }
+    }
+
+    /* new patterns fill the first shards with room, so removals leave no holes for long */
+    size_t free = 0;
+
+    for (auto &pattern : added)
+    {
+        while (free < touched.size() && (touched[free] ? pendingIds[free].size() : next->shards[free]->ids.size()) >= _shardSize)
+            free++;
+
+        if (free == touched.size())
+        {
+            next->shards.emplace_back();
+            touched.push_back(false);
+            pendingIds.emplace_back();
+            pendingPatterns.emplace_back();
+            touched[free] = true;
+        }
+
+        touch(free);
+        ids.push_back(_next);
+        pendingIds[free].push_back(_next++);
+        pendingPatterns[free].push_back(std::move(pattern));
+    }
+
+    /* only the shards changed are rebuilt, the empty ones are dropped */
+    size_t size = 0;
+
+    for (size_t i = 0; i < touched.size(); i++)
+    {
+        if (touched[i] && pendingIds[i].empty())
+            continue;
+
+        if (touched[i])
+            next->shards[size] = build(std::move(pendingIds[i]), std::move(pendingPatterns[i]));
+        else
+            next->shards[size] = std::move(next->shards[i]);
+
+        size++;
+    }
+
+    next->shards.resize(size);
+    next->size = current->size + ids.size() - count;
+
+#if defined(__cpp_lib_atomic_shared_ptr)
+    _snapshot.store(std::move(next));
+#else
+    std::atomic_store(&_snapshot, std::shared_ptr<const Snapshot>(std::move(next)));
+#endif
+}
+
+size_t RegExpSet::add(const std::string &pattern, int flags)
+{
+    return add(std::vector<std::string>(1, pattern), flags)[0];
+}
+
+std::vector<size_t> RegExpSet::add(const std::vector<std::string> &patterns, int flags)
+{
+    size_t count;
+    std::vector<size_t> ids;
+    std::vector<std::shared_ptr<const RegExp>> compiled;
+
+    /* compiled before taking the lock, so a syntax error changes nothing */
+    for (const std::string &pattern : patterns)
+        compiled.push_back(std::make_shared<const RegExp>(pattern, flags, &_fragments));
+
+    update(std::move(compiled), {}, ids, count);
+    return ids;
+}
+
+size_t RegExpSet::remove(const std::vector<size_t> &ids)
+{
+    size_t count;
+    std::vector<size_t> added;
+
+    update({}, ids, added, count);
+    return count;
+}
+
+bool RegExpSet::test(const std::string &str) const
+{
+    std::shared_ptr<const Snapshot> snapshot = load();
+
+    for (const auto &shard : snapshot->shards)
+    {
+        /* the alternation matching is enough, it only has patterns of the shard in it */
+        if (united(*shard, str))
+            return true;
+
+        for (size_t i : shard->others)
+            if (shard->patterns[i]->test(str))
+                return true;
+    }
+
+    return false;
+}
+
+void RegExpSet::match(const std::string &str, std::vector<size_t> &ids) const
+{
+    std::shared_ptr<const Snapshot> snapshot = load();
+
+    ids.clear();
+
+    for (const auto &shard : snapshot->shards)
+    {
+        if (united(*shard, str))
+            for (size_t i : shard->united)
+                if (shard->patterns[i]->test(str))
+                    ids.push_back(shard->ids[i]);
+
+        for (size_t i : shard->others)
+            if (shard->patterns[i]->test(str))
+                ids.push_back(shard->ids[i]);
+    }
+
+    /* shards are filled in the order room is found, not in the order of ids */
+    std::sort(ids.begin(), ids.end());
+}
+}
@@ -0,0 +1,354 @@
+#include <cstring>
+
+#include "Scanner.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define FASTREGEXP_SCANNER_SIMD
+#endif
+
+namespace FastRegExp
+{
+Scanner::Scanner(const ByteSet &set) : _type(Type::ScannerScalar), _tier(CPU::tier()), _set(set)
+{
+    size_t count = set.count();
+
+    if (count == 256)
+    {
+        _type = Type::ScannerAll;
+        return;
+    }
+
+    /* negated classes of a few bytes, like `[^"]` or `.`, a single one is left to `memchr` on every tier */
+    if (count >= 252)
+    {
+        for (unsigned int ch = 0; ch < 256; ch++)
+            if (!set.test(static_cast<uint8_t>(ch)))
+                _bytes[_count++] = static_cast<uint8_t>(ch);
+
+        if (_count == 1 || _tier >= CPU::Tier::TierSSE2)
+        {
+            _type = Type::ScannerExcept;
+            return;
+        }
+    }
+
+    unsigned int lower = 0;
+    unsigned int upper = 255;
+
+    /* contiguous ranges, like `[0-9]` */
+    while (lower < 256 && !set.test(static_cast<uint8_t>(lower))) lower++;
+    while (upper > lower && !set.test(static_cast<uint8_t>(upper))) upper--;
+
+    if (_tier >= CPU::Tier::TierSSE2 && count != 0 && count == upper - lower + 1)
+    {
+        _bytes[0] = static_cast<uint8_t>(lower);
+        _bytes[1] = static_cast<uint8_t>(upper);
+        _type = Type::ScannerRange;
+        return;
+    }
+
+    /* everything else, like `\w` or `\s`, needs byte shuffles */
+    if (_tier >= CPU::Tier::TierSSSE3 && count != 0)
+    {
+        for (unsigned int ch = 0; ch < 256; ch++)
+        {
+            if (set.test(static_cast<uint8_t>(ch)))
+            {
+                if (ch < 0x80)
+                    _lower[ch & 15] |= 1u << (ch >> 4);
+                else
+                    _upper[ch & 15] |= 1u << ((ch >> 4) - 8);
+            }
+        }
+
+        _type = Type::ScannerTable;
+        return;
+    }
+
+    _tier = CPU::Tier::TierScalar;
+}
+
+#ifdef FASTREGEXP_SCANNER_SIMD
+size_t Scanner::spanRange(const uint8_t *str, size_t len) const
+{
+    size_t i = 0;
+    __m128i lower = _mm_set1_epi8(static_cast<char>(_bytes[0]));
+    __m128i width = _mm_set1_epi8(static_cast<char>(_bytes[1] - _bytes[0]));
+
+    /* `x - lower` wraps around for bytes below the range, so a single unsigned comparison is enough */
+    for (; i + 16 <= len; i += 16)
+    {
+        __m128i x = _mm_sub_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(str + i)), lower);
+        unsigned int mask = ~_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(x, width), x)) & 0xffff;
+
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+
+    while (i < len && _set.test(str[i]))
+        i++;
+
+    return i;
+}
+
+size_t Scanner::spanExcept(const uint8_t *str, size_t len) const
+{
+    size_t i = 0;
+    __m128i bytes[4];
+
+    for (size_t j = 0; j < _count; j++)
+        bytes[j] = _mm_set1_epi8(static_cast<char>(_bytes[j]));
+
+    for (; i + 16 <= len; i += 16)
+    {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(str + i));
+        __m128i found = _mm_setzero_si128();
+
+        for (size_t j = 0; j < _count; j++)
+            found = _mm_or_si128(found, _mm_cmpeq_epi8(x, bytes[j]));
+
+        unsigned int mask = _mm_movemask_epi8(found);
+
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+
+    while (i < len && _set.test(str[i]))
+        i++;
+
+    return i;
+}
+
+__attribute__((target("ssse3")))
+size_t Scanner::spanTable(const uint8_t *str, size_t len) const
+{
+    size_t i = 0;
+    __m128i lower = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_lower));
+    __m128i upper = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_upper));
+    __m128i nibble = _mm_set1_epi8(0x0f);
+    __m128i bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+
+    /* the low nibble selects a row of bits, the high nibble selects the bit */
+    for (; i + 16 <= len; i += 16)
+    {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(str + i));
+        __m128i lo = _mm_and_si128(x, nibble);
+        __m128i hi = _mm_and_si128(_mm_srli_epi16(x, 4), nibble);
+        __m128i high = _mm_cmplt_epi8(x, _mm_setzero_si128());
+
+        __m128i row = _mm_or_si128(
+            _mm_andnot_si128(high, _mm_shuffle_epi8(lower, lo)),
+            _mm_and_si128(high, _mm_shuffle_epi8(upper, lo))
+        );
+
+        __m128i bit = _mm_shuffle_epi8(bits, hi);
+        unsigned int mask = ~_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(row, bit), bit)) & 0xffff;
+
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+
+    while (i < len && _set.test(str[i]))
+        i++;
+
+    return i;
+}
+
+__attribute__((target("avx2")))
+size_t Scanner::spanRange256(const uint8_t *str, size_t len) const
+{
+    size_t i = 0;
+    __m256i lower = _mm256_set1_epi8(static_cast<char>(_bytes[0]));
+    __m256i width = _mm256_set1_epi8(static_cast<char>(_bytes[1] - _bytes[0]));
+
+    for (; i + 32 <= len; i += 32)
+    {
+        __m256i x = _mm256_sub_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(str + i)), lower);
+        uint32_t mask = ~static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_min_epu8(x, width), x)));
+
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+
+    return i + spanRange(str + i, len - i);
+}
+
+__attribute__((target("avx2")))
+size_t Scanner::spanExcept256(const uint8_t *str, size_t len) const
+{
+    size_t i = 0;
+    __m256i bytes[4];
+
+    for (size_t j = 0; j < _count; j++)
+        bytes[j] = _mm256_set1_epi8(static_cast<char>(_bytes[j]));
+
+    for (; i + 32 <= len; i += 32)
+    {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(str + i));
+        __m256i found = _mm256_setzero_si256();
+
+        for (size_t j = 0; j < _count; j++)
+            found = _mm256_or_si256(found, _mm256_cmpeq_epi8(x, bytes[j]));
+
+        uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(found));
+
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+
+    return i + spanExcept(str + i, len - i);
+}
+
+__attribute__((target("avx2")))
+size_t Scanner::spanTable256(const uint8_t *str, size_t len) const
+{
+    size_t i = 0;
+    __m256i lower = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(_lower)));
+    __m256i upper = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(_upper)));
+    __m256i nibble = _mm256_set1_epi8(0x0f);
+    __m256i bits = _mm256_broadcastsi128_si256(_mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128));
+
+    /* shuffles stay within 16 byte lanes, so every table is repeated in both */
+    for (; i + 32 <= len; i += 32)
+    {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(str + i));
+        __m256i lo = _mm256_and_si256(x, nibble);
+        __m256i hi = _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble);
+        __m256i high = _mm256_cmpgt_epi8(_mm256_setzero_si256(), x);
+
+        __m256i row = _mm256_blendv_epi8(_mm256_shuffle_epi8(lower, lo), _mm256_shuffle_epi8(upper, lo), high);
+        __m256i bit = _mm256_shuffle_epi8(bits, hi);
+        uint32_t mask = ~static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(row, bit), bit)));
+
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+
+    return i + spanTable(str + i, len - i);
+}
+
+__attribute__((target("avx512bw")))
+size_t Scanner::spanRange512(const uint8_t *str, size_t len) const
+{
+    size_t i = 0;
+    __m512i lower = _mm512_set1_epi8(static_cast<char>(_bytes[0]));
+    __m512i width = _mm512_set1_epi8(static_cast<char>(_bytes[1] - _bytes[0]));
+
+    for (; i + 64 <= len; i += 64)
+    {
+        __m512i x = _mm512_sub_epi8(_mm512_loadu_si512(str + i), lower);
+        uint64_t mask = ~static_cast<uint64_t>(_mm512_cmple_epu8_mask(x, width));
+
+        if (mask)
+            return i + __builtin_ctzll(mask);
+    }
+
+    return i + spanRange256(str + i, len - i);
+}
+
+__attribute__((target("avx512bw")))
+size_t Scanner::spanExcept512(const uint8_t *str, size_t len) const
+{
+    size_t i = 0;
+    __m512i bytes[4];
+
+    for (size_t j = 0; j < _count; j++)
+        bytes[j] = _mm512_set1_epi8(static_cast<char>(_bytes[j]));
+
+    for (; i + 64 <= len; i += 64)
+    {
+        __m512i x = _mm512_loadu_si512(str + i);
+        uint64_t mask = 0;
+
+        for (size_t j = 0; j < _count; j++)
+            mask |= _mm512_cmpeq_epi8_mask(x, bytes[j]);
+
+        if (mask)
+            return i + __builtin_ctzll(mask);
+    }
+
+    return i + spanExcept256(str + i, len - i);
+}
+
+__attribute__((target("avx512bw")))
+size_t Scanner::spanTable512(const uint8_t *str, size_t len) const
+{
+    size_t i = 0;
+    __m512i lower = _mm512_maskz_broadcast_i32x4(~0, _mm_loadu_si128(reinterpret_cast<const __m128i *>(_lower)));
+    __m512i upper = _mm512_maskz_broadcast_i32x4(~0, _mm_loadu_si128(reinterpret_cast<const __m128i *>(_upper)));
+    __m512i nibble = _mm512_set1_epi8(0x0f);
+    __m512i bits = _mm512_maskz_broadcast_i32x4(~0, _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128));
+
+    for (; i + 64 <= len; i += 64)
+    {
+        __m512i x = _mm512_loadu_si512(str + i);
+        __m512i lo = _mm512_and_si512(x, nibble);
+        __m512i hi = _mm512_and_si512(_mm512_srli_epi16(x, 4), nibble);
+
+        __m512i row = _mm512_mask_blend_epi8(_mm512_movepi8_mask(x), _mm512_shuffle_epi8(lower, lo), _mm512_shuffle_epi8(upper, lo));
+        uint64_t mask = ~static_cast<uint64_t>(_mm512_test_epi8_mask(row, _mm512_shuffle_epi8(bits, hi)));
+
+        if (mask)
+            return i + __builtin_ctzll(mask);
+    }
+
+    return i + spanTable256(str + i, len - i);
+}
+#endif
+
+size_t Scanner::span(const uint8_t *str, size_t len) const
+{
+    size_t i = 0;
+
+    switch (_type)
+    {
+        case Type::ScannerAll:
+            return len;
+
+        case Type::ScannerScalar:
+            break;
+
+        case Type::ScannerExcept:
+        {
+            if (_count == 1)
+            {
+                const void *end = memchr(str, _bytes[0], len);
+                return end ? static_cast<const uint8_t *>(end) - str : len;
+            }
+
+#ifdef FASTREGEXP_SCANNER_SIMD
+            if (_tier >= CPU::Tier::TierAVX512) return spanExcept512(str, len);
+            if (_tier >= CPU::Tier::TierAVX2) return spanExcept256(str, len);
+            return spanExcept(str, len);
+#else
+            break;
+#endif
+        }
+
+#ifdef FASTREGEXP_SCANNER_SIMD
+        case Type::ScannerRange:
+        {
+            if (_tier >= CPU::Tier::TierAVX512) return spanRange512(str, len);
+            if (_tier >= CPU::Tier::TierAVX2) return spanRange256(str, len);
+            return spanRange(str, len);
+        }
+
+        case Type::ScannerTable:
+        {
+            if (_tier >= CPU::Tier::TierAVX512) return spanTable512(str, len);
+            if (_tier >= CPU::Tier::TierAVX2) return spanTable256(str, len);
+            return spanTable(str, len);
+        }
+#else
+        default:
+            break;
+#endif
+    }
+
+    while (i < len && _set.test(str[i]))
+        i++;
+
+    return i;
+}
+}
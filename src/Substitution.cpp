@@ -0,0 +1,113 @@
+#include "Substitution.h"
+
+namespace FastRegExp
+{
+Substitution::Substitution(const std::string &format, const Program &program) : _format(format)
+{
+    size_t pos = 0;
+    size_t text = 0;
+
+    while ((pos = _format.find('$', pos)) != std::string::npos)
+    {
+        size_t begin = pos++;
+        size_t group = 0;
+
+        if (pos >= _format.size())
+            throw SyntaxError(begin, "Incomplete group reference");
+
+        /* `$$` keeps the second dollar sign as text */
+        if (_format[pos] == '$')
+        {
+            addText(text, pos);
+            text = ++pos;
+            continue;
+        }
+
+        if (_format[pos] >= '0' && _format[pos] <= '9')
+        {
+            group = parseGroup(begin, pos, _format.size(), program.groups);
+        }
+        else if (_format[pos] == '{')
+        {
+            size_t end = _format.find('}', pos);
+
+            if (end == std::string::npos || end == pos + 1)
+                throw SyntaxError(begin, "Incomplete group reference");
+
+            std::string name = _format.substr(pos + 1, end - pos - 1);
+            auto iter = program.names.find(name);
+
+            if (iter != program.names.end())
+            {
+                group = iter->second;
+            }
+            else
+            {
+                if (name.find_first_not_of("0123456789") != std::string::npos)
+                    throw SyntaxError(begin, "Unknown group name \"" + name + "\"");
+
+                pos++;
+                group = parseGroup(begin, pos, end, program.groups);
+            }
+
+            pos = end + 1;
+        }
+        else
+        {
+            throw SyntaxError(begin, "Invalid group reference");
+        }
+
+        addText(text, begin);
+        _parts.push_back({ static_cast<ssize_t>(group), 0, 0 });
+        text = pos;
+    }
+
+    addText(text, _format.size());
+}
+
+size_t Substitution::parseGroup(size_t begin, size_t &pos, size_t end, size_t groups) const
+{
+    size_t group = 0;
+    size_t digits = pos;
+
+    /* accumulating stops past the last group, so long references can't overflow */
+    while (pos < end && _format[pos] >= '0' && _format[pos] <= '9')
+    {
+        group = group * 10 + (_format[pos++] - '0');
+
+        if (group > groups)
+        {
+            while (pos < end && _format[pos] >= '0' && _format[pos] <= '9')
+                pos++;
+
+            throw SyntaxError(begin, "Unknown group " + _format.substr(digits, pos - digits));
+        }
+    }
+
+    return group;
+}
+
+void Substitution::addText(size_t begin, size_t end)
+{
+    if (begin != end)
+        _parts.push_back({ -1, begin, end });
+}
+
+void Substitution::expand(const char *str, const std::vector<ssize_t> &slots, std::string &out) const
+{
+    for (const Part &part : _parts)
+    {
+        if (part.group < 0)
+        {
+            out.append(_format, part.begin, part.end - part.begin);
+            continue;
+        }
+
+        ssize_t begin = slots[part.group * 2];
+        ssize_t end = slots[part.group * 2 + 1];
+
+        if (begin >= 0 && end >= begin)
+            out.append(str + begin, end - begin);
+    }
+}
+}
@@ -0,0 +1,229 @@
+#include <new>
+#include <iterator>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+#include "TableAllocator.h"
+
+namespace FastRegExp
+{
+static size_t roundUp(size_t size, size_t unit)
+{
+    return (size + unit - 1) / unit * unit;
+}
+
+Table::~Table()
+{
+    /* heap tables belong to no chunk */
+    if (_chunk)
+        _allocator->release(_chunk, _offset, _size);
+    else
+        delete[] _copies.front();
+}
+
+TableAllocator::TableAllocator()
+{
+    if (const char *value = getenv("FASTREGEXP_REPLICATE"))
+        _isReplicated = !strcmp(value, "1");
+}
+
+TableAllocator::~TableAllocator()
+{
+    for (auto &chunk : _chunks)
+        unmap(*chunk);
+}
+
+TableAllocator &TableAllocator::instance(void)
+{
+    static TableAllocator *allocator = new TableAllocator();
+    return *allocator;
+}
+
+bool TableAllocator::isReplicated(void)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _isReplicated;
+}
+
+void TableAllocator::setReplicated(bool isReplicated)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _isReplicated = isReplicated;
+}
+
+TableAllocator::Chunk *TableAllocator::map(size_t size, bool isShared)
+{
+    Pages::Policy policy = Pages::policy();
+    size_t copies = _isReplicated ? Pages::nodes() : 1;
+    std::unique_ptr<Chunk> chunk(new Chunk());
+
+    chunk->size = SIZE_MAX;
+    chunk->used = 0;
+    chunk->isShared = isShared;
+
+    /* each copy prefers the memory of it's node, a single one goes wherever the kernel puts it */
+    for (size_t node = 0; node < copies; node++)
+    {
+        Copy copy;
+
+        if (!(copy.data = static_cast<uint8_t *>(Pages::map(size, policy, copies > 1 ? static_cast<ssize_t>(node) : -1, copy.mapped))))
+        {
+            unmap(*chunk);
+            throw std::bad_alloc();
+        }
+
+        /* the whole mapping is usable, huge pages round it up */
+        chunk->size = std::min(chunk->size, copy.mapped);
+        chunk->copies.push_back(copy);
+        _usage.mapped += copy.mapped;
+    }
+
+    if (isShared)
+        chunk->free.emplace(0, chunk->size);
+
+    _usage.chunks++;
+    _chunks.push_back(std::move(chunk));
+    return _chunks.back().get();
+}
+
+void TableAllocator::unmap(Chunk &chunk)
+{
+    for (const Copy &copy : chunk.copies)
+    {
+        Pages::unmap(copy.data, copy.mapped);
+        _usage.mapped -= copy.mapped;
+    }
+}
+
+void TableAllocator::release(void *chunk, size_t offset, size_t size)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    size_t need = roundUp(std::max(size, static_cast<size_t>(1)), Alignment);
+    auto owner = std::find_if(_chunks.begin(), _chunks.end(), [&](const std::unique_ptr<Chunk> &x){ return x.get() == chunk; });
+    Chunk &block = **owner;
+
+    block.used -= need;
+    _usage.used -= need * block.copies.size();
+    _usage.tables--;
+
+    /* tables mapped on their own go away with them */
+    if (!block.isShared)
+    {
+        unmap(block);
+        _usage.chunks--;
+        _chunks.erase(owner);
+        return;
+    }
+
+    /* merge with the free blocks on either side */
+    auto next = block.free.lower_bound(offset);
+
+    if (next != block.free.end() && offset + need == next->first)
+    {
+        need += next->second;
+        next = block.free.erase(next);
+    }
+
+    if (next != block.free.begin() && std::prev(next)->first + std::prev(next)->second == offset)
+        std::prev(next)->second += need;
+    else
+        block.free.emplace(offset, need);
+
+    /* one empty chunk is kept around, so adding and dropping a single pattern doesn't map and unmap every time */
+    if (block.used == 0)
+    {
+        for (auto &other : _chunks)
+        {
+            if (other.get() != &block && other->isShared && other->used == 0)
+            {
+                unmap(block);
+                _usage.chunks--;
+                _chunks.erase(owner);
+                break;
+            }
+        }
+    }
+}
+
+std::shared_ptr<Table> TableAllocator::allocate(const void *data, size_t size)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    Chunk *chunk = nullptr;
+    size_t offset = 0;
+    size_t copies = _isReplicated ? Pages::nodes() : 1;
+    size_t need = roundUp(std::max(size, static_cast<size_t>(1)), Alignment);
+    std::map<size_t, size_t>::iterator block;
+
+    /* nothing to place, the heap does as well as anything */
+    if (copies == 1 && Pages::policy() == Pages::Policy::PolicyNormal)
+    {
+        lock.unlock();
+
+        uint8_t *mem = new uint8_t[std::max(size, static_cast<size_t>(1))];
+
+        memcpy(mem, data, size);
+        return std::shared_ptr<Table>(new Table(this, nullptr, 0, { mem }, size));
+    }
+
+    if (need > ChunkSize / 2)
+    {
+        chunk = map(need, false);
+    }
+    else
+    {
+        /* first fit within the chunks already mapped with as many copies */
+        for (auto &item : _chunks)
+        {
+            if (!item->isShared || item->copies.size() != copies)
+                continue;
+
+            for (block = item->free.begin(); block != item->free.end(); ++block)
+                if (block->second >= need)
+                    break;
+
+            if (block != item->free.end())
+            {
+                chunk = item.get();
+                break;
+            }
+        }
+
+        if (!chunk)
+        {
+            chunk = map(ChunkSize, true);
+            block = chunk->free.begin();
+        }
+
+        size_t remain = block->second - need;
+
+        offset = block->first;
+        chunk->free.erase(block);
+
+        if (remain)
+            chunk->free.emplace(offset + need, remain);
+    }
+
+    std::vector<const uint8_t *> addresses;
+
+    for (const Copy &copy : chunk->copies)
+    {
+        memcpy(copy.data + offset, data, size);
+        addresses.push_back(copy.data + offset);
+    }
+
+    chunk->used += need;
+    _usage.used += need * copies;
+    _usage.tables++;
+    return std::shared_ptr<Table>(new Table(this, chunk, offset, std::move(addresses), size));
+}
+
+TableAllocator::Usage TableAllocator::usage(void)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _usage;
+}
+}
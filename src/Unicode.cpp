@@ -0,0 +1,1559 @@
+/* the tables of this file are generated by tools/unicode.py from UnicodeData.txt, Scripts.txt and CaseFolding.txt of
+ * the Unicode 14.0 character database, run it again instead of editing them */
+#include <algorithm>
+#include "Unicode.h"
+
+struct CaseRange
+{
+    char32_t lower;
+    char32_t upper;
+    int32_t delta;
+};
+
+/* upper and lower case letters alternate within the range */
+static const int32_t Alternate = 0x7fffffff;
+
+/* simple case folding orbits of Unicode 14.0,
+ * every character in [lower, upper] maps to the next character of it's orbit by adding `delta` */
+static const CaseRange CaseRanges[] =
+{
+    { 0x00041, 0x0005a, 32 },
+    { 0x00061, 0x0006a, -32 },
+    { 0x0006b, 0x0006b, 8383 },
+    { 0x0006c, 0x00072, -32 },
+    { 0x00073, 0x00073, 268 },
+    { 0x00074, 0x0007a, -32 },
+    { 0x000b5, 0x000b5, 743 },
+    { 0x000c0, 0x000d6, 32 },
+    { 0x000d8, 0x000de, 32 },
+    { 0x000df, 0x000df, 7615 },
+    { 0x000e0, 0x000e4, -32 },
+    { 0x000e5, 0x000e5, 8262 },
+    { 0x000e6, 0x000f6, -32 },
+    { 0x000f8, 0x000fe, -32 },
+    { 0x000ff, 0x000ff, 121 },
+    { 0x00100, 0x0012f, Alternate },
+    { 0x00132, 0x00137, Alternate },
+    { 0x00139, 0x00148, Alternate },
+    { 0x0014a, 0x00177, Alternate },
+    { 0x00178, 0x00178, -121 },
+    { 0x00179, 0x0017e, Alternate },
+    { 0x0017f, 0x0017f, -300 },
+    { 0x00180, 0x00180, 195 },
+    { 0x00181, 0x00181, 210 },
+    { 0x00182, 0x00185, Alternate },
+    { 0x00186, 0x00186, 206 },
+    { 0x00187, 0x00187, 1 },
+    { 0x00188, 0x00188, -1 },
+    { 0x00189, 0x0018a, 205 },
+    { 0x0018b, 0x0018b, 1 },
+    { 0x0018c, 0x0018c, -1 },
+    { 0x0018e, 0x0018e, 79 },
+    { 0x0018f, 0x0018f, 202 },
+    { 0x00190, 0x00190, 203 },
+    { 0x00191, 0x00191, 1 },
+    { 0x00192, 0x00192, -1 },
+    { 0x00193, 0x00193, 205 },
+    { 0x00194, 0x00194, 207 },
+    { 0x00195, 0x00195, 97 },
+    { 0x00196, 0x00196, 211 },
+    { 0x00197, 0x00197, 209 },
+    { 0x00198, 0x00198, 1 },
+    { 0x00199, 0x00199, -1 },
+    { 0x0019a, 0x0019a, 163 },
+    { 0x0019c, 0x0019c, 211 },
+    { 0x0019d, 0x0019d, 213 },
+    { 0x0019e, 0x0019e, 130 },
+    { 0x0019f, 0x0019f, 214 },
+    { 0x001a0, 0x001a5, Alternate },
+    { 0x001a6, 0x001a6, 218 },
+    { 0x001a7, 0x001a7, 1 },
+    { 0x001a8, 0x001a8, -1 },
+    { 0x001a9, 0x001a9, 218 },
+    { 0x001ac, 0x001ac, 1 },
+    { 0x001ad, 0x001ad, -1 },
+    { 0x001ae, 0x001ae, 218 },
+    { 0x001af, 0x001af, 1 },
+    { 0x001b0, 0x001b0, -1 },
+    { 0x001b1, 0x001b2, 217 },
+    { 0x001b3, 0x001b6, Alternate },
+    { 0x001b7, 0x001b7, 219 },
+    { 0x001b8, 0x001b8, 1 },
+    { 0x001b9, 0x001b9, -1 },
+    { 0x001bc, 0x001bc, 1 },
+    { 0x001bd, 0x001bd, -1 },
+    { 0x001bf, 0x001bf, 56 },
+    { 0x001c4, 0x001c5, 1 },
+    { 0x001c6, 0x001c6, -2 },
+    { 0x001c7, 0x001c8, 1 },
+    { 0x001c9, 0x001c9, -2 },
+    { 0x001ca, 0x001cb, 1 },
+    { 0x001cc, 0x001cc, -2 },
+    { 0x001cd, 0x001dc, Alternate },
+    { 0x001dd, 0x001dd, -79 },
+    { 0x001de, 0x001ef, Alternate },
+    { 0x001f1, 0x001f2, 1 },
+    { 0x001f3, 0x001f3, -2 },
+    { 0x001f4, 0x001f4, 1 },
+    { 0x001f5, 0x001f5, -1 },
+    { 0x001f6, 0x001f6, -97 },
+    { 0x001f7, 0x001f7, -56 },
+    { 0x001f8, 0x0021f, Alternate },
+    { 0x00220, 0x00220, -130 },
+    { 0x00222, 0x00233, Alternate },
+    { 0x0023a, 0x0023a, 10795 },
+    { 0x0023b, 0x0023b, 1 },
+    { 0x0023c, 0x0023c, -1 },
+    { 0x0023d, 0x0023d, -163 },
+    { 0x0023e, 0x0023e, 10792 },
+    { 0x0023f, 0x00240, 10815 },
+    { 0x00241, 0x00241, 1 },
+    { 0x00242, 0x00242, -1 },
+    { 0x00243, 0x00243, -195 },
+    { 0x00244, 0x00244, 69 },
+    { 0x00245, 0x00245, 71 },
+    { 0x00246, 0x0024f, Alternate },
+    { 0x00250, 0x00250, 10783 },
+    { 0x00251, 0x00251, 10780 },
+    { 0x00252, 0x00252, 10782 },
+    { 0x00253, 0x00253, -210 },
+    { 0x00254, 0x00254, -206 },
+    { 0x00256, 0x00257, -205 },
+    { 0x00259, 0x00259, -202 },
+    { 0x0025b, 0x0025b, -203 },
+    { 0x0025c, 0x0025c, 42319 },
+    { 0x00260, 0x00260, -205 },
+    { 0x00261, 0x00261, 42315 },
+    { 0x00263, 0x00263, -207 },
+    { 0x00265, 0x00265, 42280 },
+    { 0x00266, 0x00266, 42308 },
+    { 0x00268, 0x00268, -209 },
+    { 0x00269, 0x00269, -211 },
+    { 0x0026a, 0x0026a, 42308 },
+    { 0x0026b, 0x0026b, 10743 },
+    { 0x0026c, 0x0026c, 42305 },
+    { 0x0026f, 0x0026f, -211 },
+    { 0x00271, 0x00271, 10749 },
+    { 0x00272, 0x00272, -213 },
+    { 0x00275, 0x00275, -214 },
+    { 0x0027d, 0x0027d, 10727 },
+    { 0x00280, 0x00280, -218 },
+    { 0x00282, 0x00282, 42307 },
+    { 0x00283, 0x00283, -218 },
+    { 0x00287, 0x00287, 42282 },
+    { 0x00288, 0x00288, -218 },
+    { 0x00289, 0x00289, -69 },
+    { 0x0028a, 0x0028b, -217 },
+    { 0x0028c, 0x0028c, -71 },
+    { 0x00292, 0x00292, -219 },
+    { 0x0029d, 0x0029d, 42261 },
+    { 0x0029e, 0x0029e, 42258 },
+    { 0x00345, 0x00345, 84 },
+    { 0x00370, 0x00373, Alternate },
+    { 0x00376, 0x00376, 1 },
+    { 0x00377, 0x00377, -1 },
+    { 0x0037b, 0x0037d, 130 },
+    { 0x0037f, 0x0037f, 116 },
+    { 0x00386, 0x00386, 38 },
+    { 0x00388, 0x0038a, 37 },
+    { 0x0038c, 0x0038c, 64 },
+    { 0x0038e, 0x0038f, 63 },
+    { 0x00391, 0x003a1, 32 },
+    { 0x003a3, 0x003a3, 31 },
+    { 0x003a4, 0x003ab, 32 },
+    { 0x003ac, 0x003ac, -38 },
+    { 0x003ad, 0x003af, -37 },
+    { 0x003b1, 0x003b1, -32 },
+    { 0x003b2, 0x003b2, 30 },
+    { 0x003b3, 0x003b4, -32 },
+    { 0x003b5, 0x003b5, 64 },
+    { 0x003b6, 0x003b7, -32 },
+    { 0x003b8, 0x003b8, 25 },
+    { 0x003b9, 0x003b9, 7173 },
+    { 0x003ba, 0x003ba, 54 },
+    { 0x003bb, 0x003bb, -32 },
+    { 0x003bc, 0x003bc, -775 },
+    { 0x003bd, 0x003bf, -32 },
+    { 0x003c0, 0x003c0, 22 },
+    { 0x003c1, 0x003c1, 48 },
+    { 0x003c2, 0x003c2, 1 },
+    { 0x003c3, 0x003c5, -32 },
+    { 0x003c6, 0x003c6, 15 },
+    { 0x003c7, 0x003c8, -32 },
+    { 0x003c9, 0x003c9, 7517 },
+    { 0x003ca, 0x003cb, -32 },
+    { 0x003cc, 0x003cc, -64 },
+    { 0x003cd, 0x003ce, -63 },
+    { 0x003cf, 0x003cf, 8 },
+    { 0x003d0, 0x003d0, -62 },
+    { 0x003d1, 0x003d1, 35 },
+    { 0x003d5, 0x003d5, -47 },
+    { 0x003d6, 0x003d6, -54 },
+    { 0x003d7, 0x003d7, -8 },
+    { 0x003d8, 0x003ef, Alternate },
+    { 0x003f0, 0x003f0, -86 },
+    { 0x003f1, 0x003f1, -80 },
+    { 0x003f2, 0x003f2, 7 },
+    { 0x003f3, 0x003f3, -116 },
+    { 0x003f4, 0x003f4, -92 },
+    { 0x003f5, 0x003f5, -96 },
+    { 0x003f7, 0x003f7, 1 },
+    { 0x003f8, 0x003f8, -1 },
+    { 0x003f9, 0x003f9, -7 },
+    { 0x003fa, 0x003fa, 1 },
+    { 0x003fb, 0x003fb, -1 },
+    { 0x003fd, 0x003ff, -130 },
+    { 0x00400, 0x0040f, 80 },
+    { 0x00410, 0x0042f, 32 },
+    { 0x00430, 0x00431, -32 },
+    { 0x00432, 0x00432, 6222 },
+    { 0x00433, 0x00433, -32 },
+    { 0x00434, 0x00434, 6221 },
+    { 0x00435, 0x0043d, -32 },
+    { 0x0043e, 0x0043e, 6212 },
+    { 0x0043f, 0x00440, -32 },
+    { 0x00441, 0x00442, 6210 },
+    { 0x00443, 0x00449, -32 },
+    { 0x0044a, 0x0044a, 6204 },
+    { 0x0044b, 0x0044f, -32 },
+    { 0x00450, 0x0045f, -80 },
+    { 0x00460, 0x00462, Alternate },
+    { 0x00463, 0x00463, 6180 },
+    { 0x00464, 0x00481, Alternate },
+    { 0x0048a, 0x004bf, Alternate },
+    { 0x004c0, 0x004c0, 15 },
+    { 0x004c1, 0x004ce, Alternate },
+    { 0x004cf, 0x004cf, -15 },
+    { 0x004d0, 0x0052f, Alternate },
+    { 0x00531, 0x00556, 48 },
+    { 0x00561, 0x00586, -48 },
+    { 0x010a0, 0x010c5, 7264 },
+    { 0x010c7, 0x010c7, 7264 },
+    { 0x010cd, 0x010cd, 7264 },
+    { 0x010d0, 0x010fa, 3008 },
+    { 0x010fd, 0x010ff, 3008 },
+    { 0x013a0, 0x013ef, 38864 },
+    { 0x013f0, 0x013f5, 8 },
+    { 0x013f8, 0x013fd, -8 },
+    { 0x01c80, 0x01c80, -6254 },
+    { 0x01c81, 0x01c81, -6253 },
+    { 0x01c82, 0x01c82, -6244 },
+    { 0x01c83, 0x01c83, -6242 },
+    { 0x01c84, 0x01c84, 1 },
+    { 0x01c85, 0x01c85, -6243 },
+    { 0x01c86, 0x01c86, -6236 },
+    { 0x01c87, 0x01c87, -6181 },
+    { 0x01c88, 0x01c88, 35266 },
+    { 0x01c90, 0x01cba, -3008 },
+    { 0x01cbd, 0x01cbf, -3008 },
+    { 0x01d79, 0x01d79, 35332 },
+    { 0x01d7d, 0x01d7d, 3814 },
+    { 0x01d8e, 0x01d8e, 35384 },
+    { 0x01e00, 0x01e60, Alternate },
+    { 0x01e61, 0x01e61, 58 },
+    { 0x01e62, 0x01e95, Alternate },
+    { 0x01e9b, 0x01e9b, -59 },
+    { 0x01e9e, 0x01e9e, -7615 },
+    { 0x01ea0, 0x01eff, Alternate },
+    { 0x01f00, 0x01f07, 8 },
+    { 0x01f08, 0x01f0f, -8 },
+    { 0x01f10, 0x01f15, 8 },
+    { 0x01f18, 0x01f1d, -8 },
+    { 0x01f20, 0x01f27, 8 },
+    { 0x01f28, 0x01f2f, -8 },
+    { 0x01f30, 0x01f37, 8 },
+    { 0x01f38, 0x01f3f, -8 },
+    { 0x01f40, 0x01f45, 8 },
+    { 0x01f48, 0x01f4d, -8 },
+    { 0x01f51, 0x01f51, 8 },
+    { 0x01f53, 0x01f53, 8 },
+    { 0x01f55, 0x01f55, 8 },
+    { 0x01f57, 0x01f57, 8 },
+    { 0x01f59, 0x01f59, -8 },
+    { 0x01f5b, 0x01f5b, -8 },
+    { 0x01f5d, 0x01f5d, -8 },
+    { 0x01f5f, 0x01f5f, -8 },
+    { 0x01f60, 0x01f67, 8 },
+    { 0x01f68, 0x01f6f, -8 },
+    { 0x01f70, 0x01f71, 74 },
+    { 0x01f72, 0x01f75, 86 },
+    { 0x01f76, 0x01f77, 100 },
+    { 0x01f78, 0x01f79, 128 },
+    { 0x01f7a, 0x01f7b, 112 },
+    { 0x01f7c, 0x01f7d, 126 },
+    { 0x01f80, 0x01f87, 8 },
+    { 0x01f88, 0x01f8f, -8 },
+    { 0x01f90, 0x01f97, 8 },
+    { 0x01f98, 0x01f9f, -8 },
+    { 0x01fa0, 0x01fa7, 8 },
+    { 0x01fa8, 0x01faf, -8 },
+    { 0x01fb0, 0x01fb1, 8 },
+    { 0x01fb3, 0x01fb3, 9 },
+    { 0x01fb8, 0x01fb9, -8 },
+    { 0x01fba, 0x01fbb, -74 },
+    { 0x01fbc, 0x01fbc, -9 },
+    { 0x01fbe, 0x01fbe, -7289 },
+    { 0x01fc3, 0x01fc3, 9 },
+    { 0x01fc8, 0x01fcb, -86 },
+    { 0x01fcc, 0x01fcc, -9 },
+    { 0x01fd0, 0x01fd1, 8 },
+    { 0x01fd8, 0x01fd9, -8 },
+    { 0x01fda, 0x01fdb, -100 },
+    { 0x01fe0, 0x01fe1, 8 },
+    { 0x01fe5, 0x01fe5, 7 },
+    { 0x01fe8, 0x01fe9, -8 },
+    { 0x01fea, 0x01feb, -112 },
+    { 0x01fec, 0x01fec, -7 },
+    { 0x01ff3, 0x01ff3, 9 },
+    { 0x01ff8, 0x01ff9, -128 },
+    { 0x01ffa, 0x01ffb, -126 },
+    { 0x01ffc, 0x01ffc, -9 },
+    { 0x02126, 0x02126, -7549 },
+    { 0x0212a, 0x0212a, -8415 },
+    { 0x0212b, 0x0212b, -8294 },
+    { 0x02132, 0x02132, 28 },
+    { 0x0214e, 0x0214e, -28 },
+    { 0x02160, 0x0216f, 16 },
+    { 0x02170, 0x0217f, -16 },
+    { 0x02183, 0x02183, 1 },
+    { 0x02184, 0x02184, -1 },
+    { 0x024b6, 0x024cf, 26 },
+    { 0x024d0, 0x024e9, -26 },
+    { 0x02c00, 0x02c2f, 48 },
+    { 0x02c30, 0x02c5f, -48 },
+    { 0x02c60, 0x02c60, 1 },
+    { 0x02c61, 0x02c61, -1 },
+    { 0x02c62, 0x02c62, -10743 },
+    { 0x02c63, 0x02c63, -3814 },
+    { 0x02c64, 0x02c64, -10727 },
+    { 0x02c65, 0x02c65, -10795 },
+    { 0x02c66, 0x02c66, -10792 },
+    { 0x02c67, 0x02c6c, Alternate },
+    { 0x02c6d, 0x02c6d, -10780 },
+    { 0x02c6e, 0x02c6e, -10749 },
+    { 0x02c6f, 0x02c6f, -10783 },
+    { 0x02c70, 0x02c70, -10782 },
+    { 0x02c72, 0x02c72, 1 },
+    { 0x02c73, 0x02c73, -1 },
+    { 0x02c75, 0x02c75, 1 },
+    { 0x02c76, 0x02c76, -1 },
+    { 0x02c7e, 0x02c7f, -10815 },
+    { 0x02c80, 0x02ce3, Alternate },
+    { 0x02ceb, 0x02cee, Alternate },
+    { 0x02cf2, 0x02cf2, 1 },
+    { 0x02cf3, 0x02cf3, -1 },
+    { 0x02d00, 0x02d25, -7264 },
+    { 0x02d27, 0x02d27, -7264 },
+    { 0x02d2d, 0x02d2d, -7264 },
+    { 0x0a640, 0x0a64a, Alternate },
+    { 0x0a64b, 0x0a64b, -35267 },
+    { 0x0a64c, 0x0a66d, Alternate },
+    { 0x0a680, 0x0a69b, Alternate },
+    { 0x0a722, 0x0a72f, Alternate },
+    { 0x0a732, 0x0a76f, Alternate },
+    { 0x0a779, 0x0a77c, Alternate },
+    { 0x0a77d, 0x0a77d, -35332 },
+    { 0x0a77e, 0x0a787, Alternate },
+    { 0x0a78b, 0x0a78b, 1 },
+    { 0x0a78c, 0x0a78c, -1 },
+    { 0x0a78d, 0x0a78d, -42280 },
+    { 0x0a790, 0x0a793, Alternate },
+    { 0x0a794, 0x0a794, 48 },
+    { 0x0a796, 0x0a7a9, Alternate },
+    { 0x0a7aa, 0x0a7aa, -42308 },
+    { 0x0a7ab, 0x0a7ab, -42319 },
+    { 0x0a7ac, 0x0a7ac, -42315 },
+    { 0x0a7ad, 0x0a7ad, -42305 },
+    { 0x0a7ae, 0x0a7ae, -42308 },
+    { 0x0a7b0, 0x0a7b0, -42258 },
+    { 0x0a7b1, 0x0a7b1, -42282 },
+    { 0x0a7b2, 0x0a7b2, -42261 },
+    { 0x0a7b3, 0x0a7b3, 928 },
+    { 0x0a7b4, 0x0a7c3, Alternate },
+    { 0x0a7c4, 0x0a7c4, -48 },
+    { 0x0a7c5, 0x0a7c5, -42307 },
+    { 0x0a7c6, 0x0a7c6, -35384 },
+    { 0x0a7c7, 0x0a7ca, Alternate },
+    { 0x0a7d0, 0x0a7d0, 1 },
+    { 0x0a7d1, 0x0a7d1, -1 },
+    { 0x0a7d6, 0x0a7d9, Alternate },
+    { 0x0a7f5, 0x0a7f5, 1 },
+    { 0x0a7f6, 0x0a7f6, -1 },
+    { 0x0ab53, 0x0ab53, -928 },
+    { 0x0ab70, 0x0abbf, -38864 },
+    { 0x0ff21, 0x0ff3a, 32 },
+    { 0x0ff41, 0x0ff5a, -32 },
+    { 0x10400, 0x10427, 40 },
+    { 0x10428, 0x1044f, -40 },
+    { 0x104b0, 0x104d3, 40 },
+    { 0x104d8, 0x104fb, -40 },
+    { 0x10570, 0x1057a, 39 },
+    { 0x1057c, 0x1058a, 39 },
+    { 0x1058c, 0x10592, 39 },
+    { 0x10594, 0x10595, 39 },
+    { 0x10597, 0x105a1, -39 },
+    { 0x105a3, 0x105b1, -39 },
+    { 0x105b3, 0x105b9, -39 },
+    { 0x105bb, 0x105bc, -39 },
+    { 0x10c80, 0x10cb2, 64 },
+    { 0x10cc0, 0x10cf2, -64 },
+    { 0x118a0, 0x118bf, 32 },
+    { 0x118c0, 0x118df, -32 },
+    { 0x16e40, 0x16e5f, 32 },
+    { 0x16e60, 0x16e7f, -32 },
+    { 0x1e900, 0x1e921, 34 },
+    { 0x1e922, 0x1e943, -34 },
+};
+
+/* general categories, numbered as in `CategoryRuns` */
+enum Category : uint32_t
+{
+    CategoryLu = 1u << 0,
+    CategoryLl = 1u << 1,
+    CategoryLt = 1u << 2,
+    CategoryLm = 1u << 3,
+    CategoryLo = 1u << 4,
+    CategoryMn = 1u << 5,
+    CategoryMc = 1u << 6,
+    CategoryMe = 1u << 7,
+    CategoryNd = 1u << 8,
+    CategoryNl = 1u << 9,
+    CategoryNo = 1u << 10,
+    CategoryPc = 1u << 11,
+    CategoryPd = 1u << 12,
+    CategoryPs = 1u << 13,
+    CategoryPe = 1u << 14,
+    CategoryPi = 1u << 15,
+    CategoryPf = 1u << 16,
+    CategoryPo = 1u << 17,
+    CategorySm = 1u << 18,
+    CategorySc = 1u << 19,
+    CategorySk = 1u << 20,
+    CategorySo = 1u << 21,
+    CategoryZs = 1u << 22,
+    CategoryZl = 1u << 23,
+    CategoryZp = 1u << 24,
+    CategoryCc = 1u << 25,
+    CategoryCf = 1u << 26,
+    CategoryCs = 1u << 27,
+    CategoryCo = 1u << 28,
+    CategoryCn = 1u << 29,
+};
+
+static const uint32_t CategoryL = CategoryLu | CategoryLl | CategoryLt | CategoryLm | CategoryLo;
+static const uint32_t CategoryM = CategoryMn | CategoryMc | CategoryMe;
+static const uint32_t CategoryN = CategoryNd | CategoryNl | CategoryNo;
+static const uint32_t CategoryP = CategoryPc | CategoryPd | CategoryPs | CategoryPe | CategoryPi | CategoryPf | CategoryPo;
+static const uint32_t CategoryS = CategorySm | CategorySc | CategorySk | CategorySo;
+static const uint32_t CategoryZ = CategoryZs | CategoryZl | CategoryZp;
+static const uint32_t CategoryC = CategoryCc | CategoryCf | CategoryCs | CategoryCo | CategoryCn;
+
+struct CategoryName
+{
+    const char *name;
+    uint32_t categories;
+};
+
+/* short and long names of every category and group of categories, as in PropertyValueAliases.txt */
+static const CategoryName CategoryNames[] =
+{
+    { "L"                    , CategoryL },
+    { "Letter"               , CategoryL },
+    { "LC"                   , CategoryLu | CategoryLl | CategoryLt },
+    { "L&"                   , CategoryLu | CategoryLl | CategoryLt },
+    { "Cased_Letter"         , CategoryLu | CategoryLl | CategoryLt },
+    { "Lu"                   , CategoryLu },
+    { "Uppercase_Letter"     , CategoryLu },
+    { "Ll"                   , CategoryLl },
+    { "Lowercase_Letter"     , CategoryLl },
+    { "Lt"                   , CategoryLt },
+    { "Titlecase_Letter"     , CategoryLt },
+    { "Lm"                   , CategoryLm },
+    { "Modifier_Letter"      , CategoryLm },
+    { "Lo"                   , CategoryLo },
+    { "Other_Letter"         , CategoryLo },
+    { "M"                    , CategoryM },
+    { "Mark"                 , CategoryM },
+    { "Combining_Mark"       , CategoryM },
+    { "Mn"                   , CategoryMn },
+    { "Nonspacing_Mark"      , CategoryMn },
+    { "Mc"                   , CategoryMc },
+    { "Spacing_Mark"         , CategoryMc },
+    { "Me"                   , CategoryMe },
+    { "Enclosing_Mark"       , CategoryMe },
+    { "N"                    , CategoryN },
+    { "Number"               , CategoryN },
+    { "Nd"                   , CategoryNd },
+    { "Decimal_Number"       , CategoryNd },
+    { "digit"                , CategoryNd },
+    { "Nl"                   , CategoryNl },
+    { "Letter_Number"        , CategoryNl },
+    { "No"                   , CategoryNo },
+    { "Other_Number"         , CategoryNo },
+    { "P"                    , CategoryP },
+    { "Punctuation"          , CategoryP },
+    { "punct"                , CategoryP },
+    { "Pc"                   , CategoryPc },
+    { "Connector_Punctuation", CategoryPc },
+    { "Pd"                   , CategoryPd },
+    { "Dash_Punctuation"     , CategoryPd },
+    { "Ps"                   , CategoryPs },
+    { "Open_Punctuation"     , CategoryPs },
+    { "Pe"                   , CategoryPe },
+    { "Close_Punctuation"    , CategoryPe },
+    { "Pi"                   , CategoryPi },
+    { "Initial_Punctuation"  , CategoryPi },
+    { "Pf"                   , CategoryPf },
+    { "Final_Punctuation"    , CategoryPf },
+    { "Po"                   , CategoryPo },
+    { "Other_Punctuation"    , CategoryPo },
+    { "S"                    , CategoryS },
+    { "Symbol"               , CategoryS },
+    { "Sm"                   , CategorySm },
+    { "Math_Symbol"          , CategorySm },
+    { "Sc"                   , CategorySc },
+    { "Currency_Symbol"      , CategorySc },
+    { "Sk"                   , CategorySk },
+    { "Modifier_Symbol"      , CategorySk },
+    { "So"                   , CategorySo },
+    { "Other_Symbol"         , CategorySo },
+    { "Z"                    , CategoryZ },
+    { "Separator"            , CategoryZ },
+    { "Zs"                   , CategoryZs },
+    { "Space_Separator"      , CategoryZs },
+    { "Zl"                   , CategoryZl },
+    { "Line_Separator"       , CategoryZl },
+    { "Zp"                   , CategoryZp },
+    { "Paragraph_Separator"  , CategoryZp },
+    { "C"                    , CategoryC },
+    { "Other"                , CategoryC },
+    { "Cc"                   , CategoryCc },
+    { "Control"              , CategoryCc },
+    { "cntrl"                , CategoryCc },
+    { "Cf"                   , CategoryCf },
+    { "Format"               , CategoryCf },
+    { "Cs"                   , CategoryCs },
+    { "Surrogate"            , CategoryCs },
+    { "Co"                   , CategoryCo },
+    { "Private_Use"          , CategoryCo },
+    { "Cn"                   , CategoryCn },
+    { "Unassigned"           , CategoryCn },
+    { "Any"                  , ~0u >> 2 },
+    { "Assigned"             , (~0u >> 2) & ~CategoryCn },
+};
+
+/* scripts, numbered as in `ScriptRuns` */
+static const char *const ScriptNames[] =
+{
+    "Unknown",
+    "Adlam",
+    "Ahom",
+    "Anatolian_Hieroglyphs",
+    "Arabic",
+    "Armenian",
+    "Avestan",
+    "Balinese",
+    "Bamum",
+    "Bassa_Vah",
+    "Batak",
+    "Bengali",
+    "Bhaiksuki",
+    "Bopomofo",
+    "Brahmi",
+    "Braille",
+    "Buginese",
+    "Buhid",
+    "Canadian_Aboriginal",
+    "Carian",
+    "Caucasian_Albanian",
+    "Chakma",
+    "Cham",
+    "Cherokee",
+    "Chorasmian",
+    "Common",
+    "Coptic",
+    "Cuneiform",
+    "Cypriot",
+    "Cypro_Minoan",
+    "Cyrillic",
+    "Deseret",
+    "Devanagari",
+    "Dives_Akuru",
+    "Dogra",
+    "Duployan",
+    "Egyptian_Hieroglyphs",
+    "Elbasan",
+    "Elymaic",
+    "Ethiopic",
+    "Georgian",
+    "Glagolitic",
+    "Gothic",
+    "Grantha",
+    "Greek",
+    "Gujarati",
+    "Gunjala_Gondi",
+    "Gurmukhi",
+    "Han",
+    "Hangul",
+    "Hanifi_Rohingya",
+    "Hanunoo",
+    "Hatran",
+    "Hebrew",
+    "Hiragana",
+    "Imperial_Aramaic",
+    "Inherited",
+    "Inscriptional_Pahlavi",
+    "Inscriptional_Parthian",
+    "Javanese",
+    "Kaithi",
+    "Kannada",
+    "Katakana",
+    "Kayah_Li",
+    "Kharoshthi",
+    "Khitan_Small_Script",
+    "Khmer",
+    "Khojki",
+    "Khudawadi",
+    "Lao",
+    "Latin",
+    "Lepcha",
+    "Limbu",
+    "Linear_A",
+    "Linear_B",
+    "Lisu",
+    "Lycian",
+    "Lydian",
+    "Mahajani",
+    "Makasar",
+    "Malayalam",
+    "Mandaic",
+    "Manichaean",
+    "Marchen",
+    "Masaram_Gondi",
+    "Medefaidrin",
+    "Meetei_Mayek",
+    "Mende_Kikakui",
+    "Meroitic_Cursive",
+    "Meroitic_Hieroglyphs",
+    "Miao",
+    "Modi",
+    "Mongolian",
+    "Mro",
+    "Multani",
+    "Myanmar",
+    "Nabataean",
+    "Nandinagari",
+    "New_Tai_Lue",
+    "Newa",
+    "Nko",
+    "Nushu",
+    "Nyiakeng_Puachue_Hmong",
+    "Ogham",
+    "Ol_Chiki",
+    "Old_Hungarian",
+    "Old_Italic",
+    "Old_North_Arabian",
+    "Old_Permic",
+    "Old_Persian",
+    "Old_Sogdian",
+    "Old_South_Arabian",
+    "Old_Turkic",
+    "Old_Uyghur",
+    "Oriya",
+    "Osage",
+    "Osmanya",
+    "Pahawh_Hmong",
+    "Palmyrene",
+    "Pau_Cin_Hau",
+    "Phags_Pa",
+    "Phoenician",
+    "Psalter_Pahlavi",
+    "Rejang",
+    "Runic",
+    "Samaritan",
+    "Saurashtra",
+    "Sharada",
+    "Shavian",
+    "Siddham",
+    "SignWriting",
+    "Sinhala",
+    "Sogdian",
+    "Sora_Sompeng",
+    "Soyombo",
+    "Sundanese",
+    "Syloti_Nagri",
+    "Syriac",
+    "Tagalog",
+    "Tagbanwa",
+    "Tai_Le",
+    "Tai_Tham",
+    "Tai_Viet",
+    "Takri",
+    "Tamil",
+    "Tangsa",
+    "Tangut",
+    "Telugu",
+    "Thaana",
+    "Thai",
+    "Tibetan",
+    "Tifinagh",
+    "Tirhuta",
+    "Toto",
+    "Ugaritic",
+    "Vai",
+    "Vithkuqi",
+    "Wancho",
+    "Warang_Citi",
+    "Yezidi",
+    "Yi",
+    "Zanabazar_Square",
+};
+
+/* general categories and scripts of every code point, derived from the Unicode 14.0 character database. each
+ * word is the first code point of a run in it's upper 24 bits and the value of the whole run in the low 8 bits,
+ * runs continue up to the next one */
+static const uint32_t CategoryRuns[] =
+{
+    0x00000019, 0x00002016, 0x00002111, 0x00002413, 0x00002511, 0x0000280d, 0x0000290e, 0x00002a11,
+    0x00002b12, 0x00002c11, 0x00002d0c, 0x00002e11, 0x00003008, 0x00003a11, 0x00003c12, 0x00003f11,
+    0x00004100, 0x00005b0d, 0x00005c11, 0x00005d0e, 0x00005e14, 0x00005f0b, 0x00006014, 0x00006101,
+    0x00007b0d, 0x00007c12, 0x00007d0e, 0x00007e12, 0x00007f19, 0x0000a016, 0x0000a111, 0x0000a213,
+    0x0000a615, 0x0000a711, 0x0000a814, 0x0000a915, 0x0000aa04, 0x0000ab0f, 0x0000ac12, 0x0000ad1a,
+    0x0000ae15, 0x0000af14, 0x0000b015, 0x0000b112, 0x0000b20a, 0x0000b414, 0x0000b501, 0x0000b611,
+    0x0000b814, 0x0000b90a, 0x0000ba04, 0x0000bb10, 0x0000bc0a, 0x0000bf11, 0x0000c000, 0x0000d712,
+    0x0000d800, 0x0000df01, 0x0000f712, 0x0000f801, 0x00010000, 0x00010101, 0x00010200, 0x00010301,
+    0x00010400, 0x00010501, 0x00010600, 0x00010701, 0x00010800, 0x00010901, 0x00010a00, 0x00010b01,
+    0x00010c00, 0x00010d01, 0x00010e00, 0x00010f01, 0x00011000, 0x00011101, 0x00011200, 0x00011301,
+    0x00011400, 0x00011501, 0x00011600, 0x00011701, 0x00011800, 0x00011901, 0x00011a00, 0x00011b01,
+    0x00011c00, 0x00011d01, 0x00011e00, 0x00011f01, 0x00012000, 0x00012101, 0x00012200, 0x00012301,
+    0x00012400, 0x00012501, 0x00012600, 0x00012701, 0x00012800, 0x00012901, 0x00012a00, 0x00012b01,
+    0x00012c00, 0x00012d01, 0x00012e00, 0x00012f01, 0x00013000, 0x00013101, 0x00013200, 0x00013301,
+    0x00013400, 0x00013501, 0x00013600, 0x00013701, 0x00013900, 0x00013a01, 0x00013b00, 0x00013c01,
+    0x00013d00, 0x00013e01, 0x00013f00, 0x00014001, 0x00014100, 0x00014201, 0x00014300, 0x00014401,
+    0x00014500, 0x00014601, 0x00014700, 0x00014801, 0x00014a00, 0x00014b01, 0x00014c00, 0x00014d01,
+    0x00014e00, 0x00014f01, 0x00015000, 0x00015101, 0x00015200, 0x00015301, 0x00015400, 0x00015501,
+    0x00015600, 0x00015701, 0x00015800, 0x00015901, 0x00015a00, 0x00015b01, 0x00015c00, 0x00015d01,
+    0x00015e00, 0x00015f01, 0x00016000, 0x00016101, 0x00016200, 0x00016301, 0x00016400, 0x00016501,
+    0x00016600, 0x00016701, 0x00016800, 0x00016901, 0x00016a00, 0x00016b01, 0x00016c00, 0x00016d01,
+    0x00016e00, 0x00016f01, 0x00017000, 0x00017101, 0x00017200, 0x00017301, 0x00017400, 0x00017501,
+    0x00017600, 0x00017701, 0x00017800, 0x00017a01, 0x00017b00, 0x00017c01, 0x00017d00, 0x00017e01,
+    0x00018100, 0x00018301, 0x00018400, 0x00018501, 0x00018600, 0x00018801, 0x00018900, 0x00018c01,
+    0x00018e00, 0x00019201, 0x00019300, 0x00019501, 0x00019600, 0x00019901, 0x00019c00, 0x00019e01,
+    0x00019f00, 0x0001a101, 0x0001a200, 0x0001a301, 0x0001a400, 0x0001a501, 0x0001a600, 0x0001a801,
+    0x0001a900, 0x0001aa01, 0x0001ac00, 0x0001ad01, 0x0001ae00, 0x0001b001, 0x0001b100, 0x0001b401,
+    0x0001b500, 0x0001b601, 0x0001b700, 0x0001b901, 0x0001bb04, 0x0001bc00, 0x0001bd01, 0x0001c004,
+    0x0001c400, 0x0001c502, 0x0001c601, 0x0001c700, 0x0001c802, 0x0001c901, 0x0001ca00, 0x0001cb02,
+    0x0001cc01, 0x0001cd00, 0x0001ce01, 0x0001cf00, 0x0001d001, 0x0001d100, 0x0001d201, 0x0001d300,
+    0x0001d401, 0x0001d500, 0x0001d601, 0x0001d700, 0x0001d801, 0x0001d900, 0x0001da01, 0x0001db00,
+    0x0001dc01, 0x0001de00, 0x0001df01, 0x0001e000, 0x0001e101, 0x0001e200, 0x0001e301, 0x0001e400,
+    0x0001e501, 0x0001e600, 0x0001e701, 0x0001e800, 0x0001e901, 0x0001ea00, 0x0001eb01, 0x0001ec00,
+    0x0001ed01, 0x0001ee00, 0x0001ef01, 0x0001f100, 0x0001f202, 0x0001f301, 0x0001f400, 0x0001f501,
+    0x0001f600, 0x0001f901, 0x0001fa00, 0x0001fb01, 0x0001fc00, 0x0001fd01, 0x0001fe00, 0x0001ff01,
+    0x00020000, 0x00020101, 0x00020200, 0x00020301, 0x00020400, 0x00020501, 0x00020600, 0x00020701,
+    0x00020800, 0x00020901, 0x00020a00, 0x00020b01, 0x00020c00, 0x00020d01, 0x00020e00, 0x00020f01,
+    0x00021000, 0x00021101, 0x00021200, 0x00021301, 0x00021400, 0x00021501, 0x00021600, 0x00021701,
+    0x00021800, 0x00021901, 0x00021a00, 0x00021b01, 0x00021c00, 0x00021d01, 0x00021e00, 0x00021f01,
+    0x00022000, 0x00022101, 0x00022200, 0x00022301, 0x00022400, 0x00022501, 0x00022600, 0x00022701,
+    0x00022800, 0x00022901, 0x00022a00, 0x00022b01, 0x00022c00, 0x00022d01, 0x00022e00, 0x00022f01,
+    0x00023000, 0x00023101, 0x00023200, 0x00023301, 0x00023a00, 0x00023c01, 0x00023d00, 0x00023f01,
+    0x00024100, 0x00024201, 0x00024300, 0x00024701, 0x00024800, 0x00024901, 0x00024a00, 0x00024b01,
+    0x00024c00, 0x00024d01, 0x00024e00, 0x00024f01, 0x00029404, 0x00029501, 0x0002b003, 0x0002c214,
+    0x0002c603, 0x0002d214, 0x0002e003, 0x0002e514, 0x0002ec03, 0x0002ed14, 0x0002ee03, 0x0002ef14,
+    0x00030005, 0x00037000, 0x00037101, 0x00037200, 0x00037301, 0x00037403, 0x00037514, 0x00037600,
+    0x00037701, 0x0003781d, 0x00037a03, 0x00037b01, 0x00037e11, 0x00037f00, 0x0003801d, 0x00038414,
+    0x00038600, 0x00038711, 0x00038800, 0x00038b1d, 0x00038c00, 0x00038d1d, 0x00038e00, 0x00039001,
+    0x00039100, 0x0003a21d, 0x0003a300, 0x0003ac01, 0x0003cf00, 0x0003d001, 0x0003d200, 0x0003d501,
+    0x0003d800, 0x0003d901, 0x0003da00, 0x0003db01, 0x0003dc00, 0x0003dd01, 0x0003de00, 0x0003df01,
+    0x0003e000, 0x0003e101, 0x0003e200, 0x0003e301, 0x0003e400, 0x0003e501, 0x0003e600, 0x0003e701,
+    0x0003e800, 0x0003e901, 0x0003ea00, 0x0003eb01, 0x0003ec00, 0x0003ed01, 0x0003ee00, 0x0003ef01,
+    0x0003f400, 0x0003f501, 0x0003f612, 0x0003f700, 0x0003f801, 0x0003f900, 0x0003fb01, 0x0003fd00,
+    0x00043001, 0x00046000, 0x00046101, 0x00046200, 0x00046301, 0x00046400, 0x00046501, 0x00046600,
+    0x00046701, 0x00046800, 0x00046901, 0x00046a00, 0x00046b01, 0x00046c00, 0x00046d01, 0x00046e00,
+    0x00046f01, 0x00047000, 0x00047101, 0x00047200, 0x00047301, 0x00047400, 0x00047501, 0x00047600,
+    0x00047701, 0x00047800, 0x00047901, 0x00047a00, 0x00047b01, 0x00047c00, 0x00047d01, 0x00047e00,
+    0x00047f01, 0x00048000, 0x00048101, 0x00048215, 0x00048305, 0x00048807, 0x00048a00, 0x00048b01,
+    0x00048c00, 0x00048d01, 0x00048e00, 0x00048f01, 0x00049000, 0x00049101, 0x00049200, 0x00049301,
+    0x00049400, 0x00049501, 0x00049600, 0x00049701, 0x00049800, 0x00049901, 0x00049a00, 0x00049b01,
+    0x00049c00, 0x00049d01, 0x00049e00, 0x00049f01, 0x0004a000, 0x0004a101, 0x0004a200, 0x0004a301,
+    0x0004a400, 0x0004a501, 0x0004a600, 0x0004a701, 0x0004a800, 0x0004a901, 0x0004aa00, 0x0004ab01,
+    0x0004ac00, 0x0004ad01, 0x0004ae00, 0x0004af01, 0x0004b000, 0x0004b101, 0x0004b200, 0x0004b301,
+    0x0004b400, 0x0004b501, 0x0004b600, 0x0004b701, 0x0004b800, 0x0004b901, 0x0004ba00, 0x0004bb01,
+    0x0004bc00, 0x0004bd01, 0x0004be00, 0x0004bf01, 0x0004c000, 0x0004c201, 0x0004c300, 0x0004c401,
+    0x0004c500, 0x0004c601, 0x0004c700, 0x0004c801, 0x0004c900, 0x0004ca01, 0x0004cb00, 0x0004cc01,
+    0x0004cd00, 0x0004ce01, 0x0004d000, 0x0004d101, 0x0004d200, 0x0004d301, 0x0004d400, 0x0004d501,
+    0x0004d600, 0x0004d701, 0x0004d800, 0x0004d901, 0x0004da00, 0x0004db01, 0x0004dc00, 0x0004dd01,
+    0x0004de00, 0x0004df01, 0x0004e000, 0x0004e101, 0x0004e200, 0x0004e301, 0x0004e400, 0x0004e501,
+    0x0004e600, 0x0004e701, 0x0004e800, 0x0004e901, 0x0004ea00, 0x0004eb01, 0x0004ec00, 0x0004ed01,
+    0x0004ee00, 0x0004ef01, 0x0004f000, 0x0004f101, 0x0004f200, 0x0004f301, 0x0004f400, 0x0004f501,
+    0x0004f600, 0x0004f701, 0x0004f800, 0x0004f901, 0x0004fa00, 0x0004fb01, 0x0004fc00, 0x0004fd01,
+    0x0004fe00, 0x0004ff01, 0x00050000, 0x00050101, 0x00050200, 0x00050301, 0x00050400, 0x00050501,
+    0x00050600, 0x00050701, 0x00050800, 0x00050901, 0x00050a00, 0x00050b01, 0x00050c00, 0x00050d01,
+    0x00050e00, 0x00050f01, 0x00051000, 0x00051101, 0x00051200, 0x00051301, 0x00051400, 0x00051501,
+    0x00051600, 0x00051701, 0x00051800, 0x00051901, 0x00051a00, 0x00051b01, 0x00051c00, 0x00051d01,
+    0x00051e00, 0x00051f01, 0x00052000, 0x00052101, 0x00052200, 0x00052301, 0x00052400, 0x00052501,
+    0x00052600, 0x00052701, 0x00052800, 0x00052901, 0x00052a00, 0x00052b01, 0x00052c00, 0x00052d01,
+    0x00052e00, 0x00052f01, 0x0005301d, 0x00053100, 0x0005571d, 0x00055903, 0x00055a11, 0x00056001,
+    0x00058911, 0x00058a0c, 0x00058b1d, 0x00058d15, 0x00058f13, 0x0005901d, 0x00059105, 0x0005be0c,
+    0x0005bf05, 0x0005c011, 0x0005c105, 0x0005c311, 0x0005c405, 0x0005c611, 0x0005c705, 0x0005c81d,
+    0x0005d004, 0x0005eb1d, 0x0005ef04, 0x0005f311, 0x0005f51d, 0x0006001a, 0x00060612, 0x00060911,
+    0x00060b13, 0x00060c11, 0x00060e15, 0x00061005, 0x00061b11, 0x00061c1a, 0x00061d11, 0x00062004,
+    0x00064003, 0x00064104, 0x00064b05, 0x00066008, 0x00066a11, 0x00066e04, 0x00067005, 0x00067104,
+    0x0006d411, 0x0006d504, 0x0006d605, 0x0006dd1a, 0x0006de15, 0x0006df05, 0x0006e503, 0x0006e705,
+    0x0006e915, 0x0006ea05, 0x0006ee04, 0x0006f008, 0x0006fa04, 0x0006fd15, 0x0006ff04, 0x00070011,
+    0x00070e1d, 0x00070f1a, 0x00071004, 0x00071105, 0x00071204, 0x00073005, 0x00074b1d, 0x00074d04,
+    0x0007a605, 0x0007b104, 0x0007b21d, 0x0007c008, 0x0007ca04, 0x0007eb05, 0x0007f403, 0x0007f615,
+    0x0007f711, 0x0007fa03, 0x0007fb1d, 0x0007fd05, 0x0007fe13, 0x00080004, 0x00081605, 0x00081a03,
+    0x00081b05, 0x00082403, 0x00082505, 0x00082803, 0x00082905, 0x00082e1d, 0x00083011, 0x00083f1d,
+    0x00084004, 0x00085905, 0x00085c1d, 0x00085e11, 0x00085f1d, 0x00086004, 0x00086b1d, 0x00087004,
+    0x00088814, 0x00088904, 0x00088f1d, 0x0008901a, 0x0008921d, 0x00089805, 0x0008a004, 0x0008c903,
+    0x0008ca05, 0x0008e21a, 0x0008e305, 0x00090306, 0x00090404, 0x00093a05, 0x00093b06, 0x00093c05,
+    0x00093d04, 0x00093e06, 0x00094105, 0x00094906, 0x00094d05, 0x00094e06, 0x00095004, 0x00095105,
+    0x00095804, 0x00096205, 0x00096411, 0x00096608, 0x00097011, 0x00097103, 0x00097204, 0x00098105,
+    0x00098206, 0x0009841d, 0x00098504, 0x00098d1d, 0x00098f04, 0x0009911d, 0x00099304, 0x0009a91d,
+    0x0009aa04, 0x0009b11d, 0x0009b204, 0x0009b31d, 0x0009b604, 0x0009ba1d, 0x0009bc05, 0x0009bd04,
+    0x0009be06, 0x0009c105, 0x0009c51d, 0x0009c706, 0x0009c91d, 0x0009cb06, 0x0009cd05, 0x0009ce04,
+    0x0009cf1d, 0x0009d706, 0x0009d81d, 0x0009dc04, 0x0009de1d, 0x0009df04, 0x0009e205, 0x0009e41d,
+    0x0009e608, 0x0009f004, 0x0009f213, 0x0009f40a, 0x0009fa15, 0x0009fb13, 0x0009fc04, 0x0009fd11,
+    0x0009fe05, 0x0009ff1d, 0x000a0105, 0x000a0306, 0x000a041d, 0x000a0504, 0x000a0b1d, 0x000a0f04,
+    0x000a111d, 0x000a1304, 0x000a291d, 0x000a2a04, 0x000a311d, 0x000a3204, 0x000a341d, 0x000a3504,
+    0x000a371d, 0x000a3804, 0x000a3a1d, 0x000a3c05, 0x000a3d1d, 0x000a3e06, 0x000a4105, 0x000a431d,
+    0x000a4705, 0x000a491d, 0x000a4b05, 0x000a4e1d, 0x000a5105, 0x000a521d, 0x000a5904, 0x000a5d1d,
+    0x000a5e04, 0x000a5f1d, 0x000a6608, 0x000a7005, 0x000a7204, 0x000a7505, 0x000a7611, 0x000a771d,
+    0x000a8105, 0x000a8306, 0x000a841d, 0x000a8504, 0x000a8e1d, 0x000a8f04, 0x000a921d, 0x000a9304,
+    0x000aa91d, 0x000aaa04, 0x000ab11d, 0x000ab204, 0x000ab41d, 0x000ab504, 0x000aba1d, 0x000abc05,
+    0x000abd04, 0x000abe06, 0x000ac105, 0x000ac61d, 0x000ac705, 0x000ac906, 0x000aca1d, 0x000acb06,
+    0x000acd05, 0x000ace1d, 0x000ad004, 0x000ad11d, 0x000ae004, 0x000ae205, 0x000ae41d, 0x000ae608,
+    0x000af011, 0x000af113, 0x000af21d, 0x000af904, 0x000afa05, 0x000b001d, 0x000b0105, 0x000b0206,
+    0x000b041d, 0x000b0504, 0x000b0d1d, 0x000b0f04, 0x000b111d, 0x000b1304, 0x000b291d, 0x000b2a04,
+    0x000b311d, 0x000b3204, 0x000b341d, 0x000b3504, 0x000b3a1d, 0x000b3c05, 0x000b3d04, 0x000b3e06,
+    0x000b3f05, 0x000b4006, 0x000b4105, 0x000b451d, 0x000b4706, 0x000b491d, 0x000b4b06, 0x000b4d05,
+    0x000b4e1d, 0x000b5505, 0x000b5706, 0x000b581d, 0x000b5c04, 0x000b5e1d, 0x000b5f04, 0x000b6205,
+    0x000b641d, 0x000b6608, 0x000b7015, 0x000b7104, 0x000b720a, 0x000b781d, 0x000b8205, 0x000b8304,
+    0x000b841d, 0x000b8504, 0x000b8b1d, 0x000b8e04, 0x000b911d, 0x000b9204, 0x000b961d, 0x000b9904,
+    0x000b9b1d, 0x000b9c04, 0x000b9d1d, 0x000b9e04, 0x000ba01d, 0x000ba304, 0x000ba51d, 0x000ba804,
+    0x000bab1d, 0x000bae04, 0x000bba1d, 0x000bbe06, 0x000bc005, 0x000bc106, 0x000bc31d, 0x000bc606,
+    0x000bc91d, 0x000bca06, 0x000bcd05, 0x000bce1d, 0x000bd004, 0x000bd11d, 0x000bd706, 0x000bd81d,
+    0x000be608, 0x000bf00a, 0x000bf315, 0x000bf913, 0x000bfa15, 0x000bfb1d, 0x000c0005, 0x000c0106,
+    0x000c0405, 0x000c0504, 0x000c0d1d, 0x000c0e04, 0x000c111d, 0x000c1204, 0x000c291d, 0x000c2a04,
+    0x000c3a1d, 0x000c3c05, 0x000c3d04, 0x000c3e05, 0x000c4106, 0x000c451d, 0x000c4605, 0x000c491d,
+    0x000c4a05, 0x000c4e1d, 0x000c5505, 0x000c571d, 0x000c5804, 0x000c5b1d, 0x000c5d04, 0x000c5e1d,
+    0x000c6004, 0x000c6205, 0x000c641d, 0x000c6608, 0x000c701d, 0x000c7711, 0x000c780a, 0x000c7f15,
+    0x000c8004, 0x000c8105, 0x000c8206, 0x000c8411, 0x000c8504, 0x000c8d1d, 0x000c8e04, 0x000c911d,
+    0x000c9204, 0x000ca91d, 0x000caa04, 0x000cb41d, 0x000cb504, 0x000cba1d, 0x000cbc05, 0x000cbd04,
+    0x000cbe06, 0x000cbf05, 0x000cc006, 0x000cc51d, 0x000cc605, 0x000cc706, 0x000cc91d, 0x000cca06,
+    0x000ccc05, 0x000cce1d, 0x000cd506, 0x000cd71d, 0x000cdd04, 0x000cdf1d, 0x000ce004, 0x000ce205,
+    0x000ce41d, 0x000ce608, 0x000cf01d, 0x000cf104, 0x000cf31d, 0x000d0005, 0x000d0206, 0x000d0404,
+    0x000d0d1d, 0x000d0e04, 0x000d111d, 0x000d1204, 0x000d3b05, 0x000d3d04, 0x000d3e06, 0x000d4105,
+    0x000d451d, 0x000d4606, 0x000d491d, 0x000d4a06, 0x000d4d05, 0x000d4e04, 0x000d4f15, 0x000d501d,
+    0x000d5404, 0x000d5706, 0x000d580a, 0x000d5f04, 0x000d6205, 0x000d641d, 0x000d6608, 0x000d700a,
+    0x000d7915, 0x000d7a04, 0x000d801d, 0x000d8105, 0x000d8206, 0x000d841d, 0x000d8504, 0x000d971d,
+    0x000d9a04, 0x000db21d, 0x000db304, 0x000dbc1d, 0x000dbd04, 0x000dbe1d, 0x000dc004, 0x000dc71d,
+    0x000dca05, 0x000dcb1d, 0x000dcf06, 0x000dd205, 0x000dd51d, 0x000dd605, 0x000dd71d, 0x000dd806,
+    0x000de01d, 0x000de608, 0x000df01d, 0x000df206, 0x000df411, 0x000df51d, 0x000e0104, 0x000e3105,
+    0x000e3204, 0x000e3405, 0x000e3b1d, 0x000e3f13, 0x000e4004, 0x000e4603, 0x000e4705, 0x000e4f11,
+    0x000e5008, 0x000e5a11, 0x000e5c1d, 0x000e8104, 0x000e831d, 0x000e8404, 0x000e851d, 0x000e8604,
+    0x000e8b1d, 0x000e8c04, 0x000ea41d, 0x000ea504, 0x000ea61d, 0x000ea704, 0x000eb105, 0x000eb204,
+    0x000eb405, 0x000ebd04, 0x000ebe1d, 0x000ec004, 0x000ec51d, 0x000ec603, 0x000ec71d, 0x000ec805,
+    0x000ece1d, 0x000ed008, 0x000eda1d, 0x000edc04, 0x000ee01d, 0x000f0004, 0x000f0115, 0x000f0411,
+    0x000f1315, 0x000f1411, 0x000f1515, 0x000f1805, 0x000f1a15, 0x000f2008, 0x000f2a0a, 0x000f3415,
+    0x000f3505, 0x000f3615, 0x000f3705, 0x000f3815, 0x000f3905, 0x000f3a0d, 0x000f3b0e, 0x000f3c0d,
+    0x000f3d0e, 0x000f3e06, 0x000f4004, 0x000f481d, 0x000f4904, 0x000f6d1d, 0x000f7105, 0x000f7f06,
+    0x000f8005, 0x000f8511, 0x000f8605, 0x000f8804, 0x000f8d05, 0x000f981d, 0x000f9905, 0x000fbd1d,
+    0x000fbe15, 0x000fc605, 0x000fc715, 0x000fcd1d, 0x000fce15, 0x000fd011, 0x000fd515, 0x000fd911,
+    0x000fdb1d, 0x00100004, 0x00102b06, 0x00102d05, 0x00103106, 0x00103205, 0x00103806, 0x00103905,
+    0x00103b06, 0x00103d05, 0x00103f04, 0x00104008, 0x00104a11, 0x00105004, 0x00105606, 0x00105805,
+    0x00105a04, 0x00105e05, 0x00106104, 0x00106206, 0x00106504, 0x00106706, 0x00106e04, 0x00107105,
+    0x00107504, 0x00108205, 0x00108306, 0x00108505, 0x00108706, 0x00108d05, 0x00108e04, 0x00108f06,
+    0x00109008, 0x00109a06, 0x00109d05, 0x00109e15, 0x0010a000, 0x0010c61d, 0x0010c700, 0x0010c81d,
+    0x0010cd00, 0x0010ce1d, 0x0010d001, 0x0010fb11, 0x0010fc03, 0x0010fd01, 0x00110004, 0x0012491d,
+    0x00124a04, 0x00124e1d, 0x00125004, 0x0012571d, 0x00125804, 0x0012591d, 0x00125a04, 0x00125e1d,
+    0x00126004, 0x0012891d, 0x00128a04, 0x00128e1d, 0x00129004, 0x0012b11d, 0x0012b204, 0x0012b61d,
+    0x0012b804, 0x0012bf1d, 0x0012c004, 0x0012c11d, 0x0012c204, 0x0012c61d, 0x0012c804, 0x0012d71d,
+    0x0012d804, 0x0013111d, 0x00131204, 0x0013161d, 0x00131804, 0x00135b1d, 0x00135d05, 0x00136011,
+    0x0013690a, 0x00137d1d, 0x00138004, 0x00139015, 0x00139a1d, 0x0013a000, 0x0013f61d, 0x0013f801,
+    0x0013fe1d, 0x0014000c, 0x00140104, 0x00166d15, 0x00166e11, 0x00166f04, 0x00168016, 0x00168104,
+    0x00169b0d, 0x00169c0e, 0x00169d1d, 0x0016a004, 0x0016eb11, 0x0016ee09, 0x0016f104, 0x0016f91d,
+    0x00170004, 0x00171205, 0x00171506, 0x0017161d, 0x00171f04, 0x00173205, 0x00173406, 0x00173511,
+    0x0017371d, 0x00174004, 0x00175205, 0x0017541d, 0x00176004, 0x00176d1d, 0x00176e04, 0x0017711d,
+    0x00177205, 0x0017741d, 0x00178004, 0x0017b405, 0x0017b606, 0x0017b705, 0x0017be06, 0x0017c605,
+    0x0017c706, 0x0017c905, 0x0017d411, 0x0017d703, 0x0017d811, 0x0017db13, 0x0017dc04, 0x0017dd05,
+    0x0017de1d, 0x0017e008, 0x0017ea1d, 0x0017f00a, 0x0017fa1d, 0x00180011, 0x0018060c, 0x00180711,
+    0x00180b05, 0x00180e1a, 0x00180f05, 0x00181008, 0x00181a1d, 0x00182004, 0x00184303, 0x00184404,
+    0x0018791d, 0x00188004, 0x00188505, 0x00188704, 0x0018a905, 0x0018aa04, 0x0018ab1d, 0x0018b004,
+    0x0018f61d, 0x00190004, 0x00191f1d, 0x00192005, 0x00192306, 0x00192705, 0x00192906, 0x00192c1d,
+    0x00193006, 0x00193205, 0x00193306, 0x00193905, 0x00193c1d, 0x00194015, 0x0019411d, 0x00194411,
+    0x00194608, 0x00195004, 0x00196e1d, 0x00197004, 0x0019751d, 0x00198004, 0x0019ac1d, 0x0019b004,
+    0x0019ca1d, 0x0019d008, 0x0019da0a, 0x0019db1d, 0x0019de15, 0x001a0004, 0x001a1705, 0x001a1906,
+    0x001a1b05, 0x001a1c1d, 0x001a1e11, 0x001a2004, 0x001a5506, 0x001a5605, 0x001a5706, 0x001a5805,
+    0x001a5f1d, 0x001a6005, 0x001a6106, 0x001a6205, 0x001a6306, 0x001a6505, 0x001a6d06, 0x001a7305,
+    0x001a7d1d, 0x001a7f05, 0x001a8008, 0x001a8a1d, 0x001a9008, 0x001a9a1d, 0x001aa011, 0x001aa703,
+    0x001aa811, 0x001aae1d, 0x001ab005, 0x001abe07, 0x001abf05, 0x001acf1d, 0x001b0005, 0x001b0406,
+    0x001b0504, 0x001b3405, 0x001b3506, 0x001b3605, 0x001b3b06, 0x001b3c05, 0x001b3d06, 0x001b4205,
+    0x001b4306, 0x001b4504, 0x001b4d1d, 0x001b5008, 0x001b5a11, 0x001b6115, 0x001b6b05, 0x001b7415,
+    0x001b7d11, 0x001b7f1d, 0x001b8005, 0x001b8206, 0x001b8304, 0x001ba106, 0x001ba205, 0x001ba606,
+    0x001ba805, 0x001baa06, 0x001bab05, 0x001bae04, 0x001bb008, 0x001bba04, 0x001be605, 0x001be706,
+    0x001be805, 0x001bea06, 0x001bed05, 0x001bee06, 0x001bef05, 0x001bf206, 0x001bf41d, 0x001bfc11,
+    0x001c0004, 0x001c2406, 0x001c2c05, 0x001c3406, 0x001c3605, 0x001c381d, 0x001c3b11, 0x001c4008,
+    0x001c4a1d, 0x001c4d04, 0x001c5008, 0x001c5a04, 0x001c7803, 0x001c7e11, 0x001c8001, 0x001c891d,
+    0x001c9000, 0x001cbb1d, 0x001cbd00, 0x001cc011, 0x001cc81d, 0x001cd005, 0x001cd311, 0x001cd405,
+    0x001ce106, 0x001ce205, 0x001ce904, 0x001ced05, 0x001cee04, 0x001cf405, 0x001cf504, 0x001cf706,
+    0x001cf805, 0x001cfa04, 0x001cfb1d, 0x001d0001, 0x001d2c03, 0x001d6b01, 0x001d7803, 0x001d7901,
+    0x001d9b03, 0x001dc005, 0x001e0000, 0x001e0101, 0x001e0200, 0x001e0301, 0x001e0400, 0x001e0501,
+    0x001e0600, 0x001e0701, 0x001e0800, 0x001e0901, 0x001e0a00, 0x001e0b01, 0x001e0c00, 0x001e0d01,
+    0x001e0e00, 0x001e0f01, 0x001e1000, 0x001e1101, 0x001e1200, 0x001e1301, 0x001e1400, 0x001e1501,
+    0x001e1600, 0x001e1701, 0x001e1800, 0x001e1901, 0x001e1a00, 0x001e1b01, 0x001e1c00, 0x001e1d01,
+    0x001e1e00, 0x001e1f01, 0x001e2000, 0x001e2101, 0x001e2200, 0x001e2301, 0x001e2400, 0x001e2501,
+    0x001e2600, 0x001e2701, 0x001e2800, 0x001e2901, 0x001e2a00, 0x001e2b01, 0x001e2c00, 0x001e2d01,
+    0x001e2e00, 0x001e2f01, 0x001e3000, 0x001e3101, 0x001e3200, 0x001e3301, 0x001e3400, 0x001e3501,
+    0x001e3600, 0x001e3701, 0x001e3800, 0x001e3901, 0x001e3a00, 0x001e3b01, 0x001e3c00, 0x001e3d01,
+    0x001e3e00, 0x001e3f01, 0x001e4000, 0x001e4101, 0x001e4200, 0x001e4301, 0x001e4400, 0x001e4501,
+    0x001e4600, 0x001e4701, 0x001e4800, 0x001e4901, 0x001e4a00, 0x001e4b01, 0x001e4c00, 0x001e4d01,
+    0x001e4e00, 0x001e4f01, 0x001e5000, 0x001e5101, 0x001e5200, 0x001e5301, 0x001e5400, 0x001e5501,
+    0x001e5600, 0x001e5701, 0x001e5800, 0x001e5901, 0x001e5a00, 0x001e5b01, 0x001e5c00, 0x001e5d01,
+    0x001e5e00, 0x001e5f01, 0x001e6000, 0x001e6101, 0x001e6200, 0x001e6301, 0x001e6400, 0x001e6501,
+    0x001e6600, 0x001e6701, 0x001e6800, 0x001e6901, 0x001e6a00, 0x001e6b01, 0x001e6c00, 0x001e6d01,
+    0x001e6e00, 0x001e6f01, 0x001e7000, 0x001e7101, 0x001e7200, 0x001e7301, 0x001e7400, 0x001e7501,
+    0x001e7600, 0x001e7701, 0x001e7800, 0x001e7901, 0x001e7a00, 0x001e7b01, 0x001e7c00, 0x001e7d01,
+    0x001e7e00, 0x001e7f01, 0x001e8000, 0x001e8101, 0x001e8200, 0x001e8301, 0x001e8400, 0x001e8501,
+    0x001e8600, 0x001e8701, 0x001e8800, 0x001e8901, 0x001e8a00, 0x001e8b01, 0x001e8c00, 0x001e8d01,
+    0x001e8e00, 0x001e8f01, 0x001e9000, 0x001e9101, 0x001e9200, 0x001e9301, 0x001e9400, 0x001e9501,
+    0x001e9e00, 0x001e9f01, 0x001ea000, 0x001ea101, 0x001ea200, 0x001ea301, 0x001ea400, 0x001ea501,
+    0x001ea600, 0x001ea701, 0x001ea800, 0x001ea901, 0x001eaa00, 0x001eab01, 0x001eac00, 0x001ead01,
+    0x001eae00, 0x001eaf01, 0x001eb000, 0x001eb101, 0x001eb200, 0x001eb301, 0x001eb400, 0x001eb501,
+    0x001eb600, 0x001eb701, 0x001eb800, 0x001eb901, 0x001eba00, 0x001ebb01, 0x001ebc00, 0x001ebd01,
+    0x001ebe00, 0x001ebf01, 0x001ec000, 0x001ec101, 0x001ec200, 0x001ec301, 0x001ec400, 0x001ec501,
+    0x001ec600, 0x001ec701, 0x001ec800, 0x001ec901, 0x001eca00, 0x001ecb01, 0x001ecc00, 0x001ecd01,
+    0x001ece00, 0x001ecf01, 0x001ed000, 0x001ed101, 0x001ed200, 0x001ed301, 0x001ed400, 0x001ed501,
+    0x001ed600, 0x001ed701, 0x001ed800, 0x001ed901, 0x001eda00, 0x001edb01, 0x001edc00, 0x001edd01,
+    0x001ede00, 0x001edf01, 0x001ee000, 0x001ee101, 0x001ee200, 0x001ee301, 0x001ee400, 0x001ee501,
+    0x001ee600, 0x001ee701, 0x001ee800, 0x001ee901, 0x001eea00, 0x001eeb01, 0x001eec00, 0x001eed01,
+    0x001eee00, 0x001eef01, 0x001ef000, 0x001ef101, 0x001ef200, 0x001ef301, 0x001ef400, 0x001ef501,
+    0x001ef600, 0x001ef701, 0x001ef800, 0x001ef901, 0x001efa00, 0x001efb01, 0x001efc00, 0x001efd01,
+    0x001efe00, 0x001eff01, 0x001f0800, 0x001f1001, 0x001f161d, 0x001f1800, 0x001f1e1d, 0x001f2001,
+    0x001f2800, 0x001f3001, 0x001f3800, 0x001f4001, 0x001f461d, 0x001f4800, 0x001f4e1d, 0x001f5001,
+    0x001f581d, 0x001f5900, 0x001f5a1d, 0x001f5b00, 0x001f5c1d, 0x001f5d00, 0x001f5e1d, 0x001f5f00,
+    0x001f6001, 0x001f6800, 0x001f7001, 0x001f7e1d, 0x001f8001, 0x001f8802, 0x001f9001, 0x001f9802,
+    0x001fa001, 0x001fa802, 0x001fb001, 0x001fb51d, 0x001fb601, 0x001fb800, 0x001fbc02, 0x001fbd14,
+    0x001fbe01, 0x001fbf14, 0x001fc201, 0x001fc51d, 0x001fc601, 0x001fc800, 0x001fcc02, 0x001fcd14,
+    0x001fd001, 0x001fd41d, 0x001fd601, 0x001fd800, 0x001fdc1d, 0x001fdd14, 0x001fe001, 0x001fe800,
+    0x001fed14, 0x001ff01d, 0x001ff201, 0x001ff51d, 0x001ff601, 0x001ff800, 0x001ffc02, 0x001ffd14,
+    0x001fff1d, 0x00200016, 0x00200b1a, 0x0020100c, 0x00201611, 0x0020180f, 0x00201910, 0x00201a0d,
+    0x00201b0f, 0x00201d10, 0x00201e0d, 0x00201f0f, 0x00202011, 0x00202817, 0x00202918, 0x00202a1a,
+    0x00202f16, 0x00203011, 0x0020390f, 0x00203a10, 0x00203b11, 0x00203f0b, 0x00204111, 0x00204412,
+    0x0020450d, 0x0020460e, 0x00204711, 0x00205212, 0x00205311, 0x0020540b, 0x00205511, 0x00205f16,
+    0x0020601a, 0x0020651d, 0x0020661a, 0x0020700a, 0x00207103, 0x0020721d, 0x0020740a, 0x00207a12,
+    0x00207d0d, 0x00207e0e, 0x00207f03, 0x0020800a, 0x00208a12, 0x00208d0d, 0x00208e0e, 0x00208f1d,
+    0x00209003, 0x00209d1d, 0x0020a013, 0x0020c11d, 0x0020d005, 0x0020dd07, 0x0020e105, 0x0020e207,
+    0x0020e505, 0x0020f11d, 0x00210015, 0x00210200, 0x00210315, 0x00210700, 0x00210815, 0x00210a01,
+    0x00210b00, 0x00210e01, 0x00211000, 0x00211301, 0x00211415, 0x00211500, 0x00211615, 0x00211812,
+    0x00211900, 0x00211e15, 0x00212400, 0x00212515, 0x00212600, 0x00212715, 0x00212800, 0x00212915,
+    0x00212a00, 0x00212e15, 0x00212f01, 0x00213000, 0x00213401, 0x00213504, 0x00213901, 0x00213a15,
+    0x00213c01, 0x00213e00, 0x00214012, 0x00214500, 0x00214601, 0x00214a15, 0x00214b12, 0x00214c15,
+    0x00214e01, 0x00214f15, 0x0021500a, 0x00216009, 0x00218300, 0x00218401, 0x00218509, 0x0021890a,
+    0x00218a15, 0x00218c1d, 0x00219012, 0x00219515, 0x00219a12, 0x00219c15, 0x0021a012, 0x0021a115,
+    0x0021a312, 0x0021a415, 0x0021a612, 0x0021a715, 0x0021ae12, 0x0021af15, 0x0021ce12, 0x0021d015,
+    0x0021d212, 0x0021d315, 0x0021d412, 0x0021d515, 0x0021f412, 0x00230015, 0x0023080d, 0x0023090e,
+    0x00230a0d, 0x00230b0e, 0x00230c15, 0x00232012, 0x00232215, 0x0023290d, 0x00232a0e, 0x00232b15,
+    0x00237c12, 0x00237d15, 0x00239b12, 0x0023b415, 0x0023dc12, 0x0023e215, 0x0024271d, 0x00244015,
+    0x00244b1d, 0x0024600a, 0x00249c15, 0x0024ea0a, 0x00250015, 0x0025b712, 0x0025b815, 0x0025c112,
+    0x0025c215, 0x0025f812, 0x00260015, 0x00266f12, 0x00267015, 0x0027680d, 0x0027690e, 0x00276a0d,
+    0x00276b0e, 0x00276c0d, 0x00276d0e, 0x00276e0d, 0x00276f0e, 0x0027700d, 0x0027710e, 0x0027720d,
+    0x0027730e, 0x0027740d, 0x0027750e, 0x0027760a, 0x00279415, 0x0027c012, 0x0027c50d, 0x0027c60e,
+    0x0027c712, 0x0027e60d, 0x0027e70e, 0x0027e80d, 0x0027e90e, 0x0027ea0d, 0x0027eb0e, 0x0027ec0d,
+    0x0027ed0e, 0x0027ee0d, 0x0027ef0e, 0x0027f012, 0x00280015, 0x00290012, 0x0029830d, 0x0029840e,
+    0x0029850d, 0x0029860e, 0x0029870d, 0x0029880e, 0x0029890d, 0x00298a0e, 0x00298b0d, 0x00298c0e,
+    0x00298d0d, 0x00298e0e, 0x00298f0d, 0x0029900e, 0x0029910d, 0x0029920e, 0x0029930d, 0x0029940e,
+    0x0029950d, 0x0029960e, 0x0029970d, 0x0029980e, 0x00299912, 0x0029d80d, 0x0029d90e, 0x0029da0d,
+    0x0029db0e, 0x0029dc12, 0x0029fc0d, 0x0029fd0e, 0x0029fe12, 0x002b0015, 0x002b3012, 0x002b4515,
+    0x002b4712, 0x002b4d15, 0x002b741d, 0x002b7615, 0x002b961d, 0x002b9715, 0x002c0000, 0x002c3001,
+    0x002c6000, 0x002c6101, 0x002c6200, 0x002c6501, 0x002c6700, 0x002c6801, 0x002c6900, 0x002c6a01,
+    0x002c6b00, 0x002c6c01, 0x002c6d00, 0x002c7101, 0x002c7200, 0x002c7301, 0x002c7500, 0x002c7601,
+    0x002c7c03, 0x002c7e00, 0x002c8101, 0x002c8200, 0x002c8301, 0x002c8400, 0x002c8501, 0x002c8600,
+    0x002c8701, 0x002c8800, 0x002c8901, 0x002c8a00, 0x002c8b01, 0x002c8c00, 0x002c8d01, 0x002c8e00,
+    0x002c8f01, 0x002c9000, 0x002c9101, 0x002c9200, 0x002c9301, 0x002c9400, 0x002c9501, 0x002c9600,
+    0x002c9701, 0x002c9800, 0x002c9901, 0x002c9a00, 0x002c9b01, 0x002c9c00, 0x002c9d01, 0x002c9e00,
+    0x002c9f01, 0x002ca000, 0x002ca101, 0x002ca200, 0x002ca301, 0x002ca400, 0x002ca501, 0x002ca600,
+    0x002ca701, 0x002ca800, 0x002ca901, 0x002caa00, 0x002cab01, 0x002cac00, 0x002cad01, 0x002cae00,
+    0x002caf01, 0x002cb000, 0x002cb101, 0x002cb200, 0x002cb301, 0x002cb400, 0x002cb501, 0x002cb600,
+    0x002cb701, 0x002cb800, 0x002cb901, 0x002cba00, 0x002cbb01, 0x002cbc00, 0x002cbd01, 0x002cbe00,
+    0x002cbf01, 0x002cc000, 0x002cc101, 0x002cc200, 0x002cc301, 0x002cc400, 0x002cc501, 0x002cc600,
+    0x002cc701, 0x002cc800, 0x002cc901, 0x002cca00, 0x002ccb01, 0x002ccc00, 0x002ccd01, 0x002cce00,
+    0x002ccf01, 0x002cd000, 0x002cd101, 0x002cd200, 0x002cd301, 0x002cd400, 0x002cd501, 0x002cd600,
+    0x002cd701, 0x002cd800, 0x002cd901, 0x002cda00, 0x002cdb01, 0x002cdc00, 0x002cdd01, 0x002cde00,
+    0x002cdf01, 0x002ce000, 0x002ce101, 0x002ce200, 0x002ce301, 0x002ce515, 0x002ceb00, 0x002cec01,
+    0x002ced00, 0x002cee01, 0x002cef05, 0x002cf200, 0x002cf301, 0x002cf41d, 0x002cf911, 0x002cfd0a,
+    0x002cfe11, 0x002d0001, 0x002d261d, 0x002d2701, 0x002d281d, 0x002d2d01, 0x002d2e1d, 0x002d3004,
+    0x002d681d, 0x002d6f03, 0x002d7011, 0x002d711d, 0x002d7f05, 0x002d8004, 0x002d971d, 0x002da004,
+    0x002da71d, 0x002da804, 0x002daf1d, 0x002db004, 0x002db71d, 0x002db804, 0x002dbf1d, 0x002dc004,
+    0x002dc71d, 0x002dc804, 0x002dcf1d, 0x002dd004, 0x002dd71d, 0x002dd804, 0x002ddf1d, 0x002de005,
+    0x002e0011, 0x002e020f, 0x002e0310, 0x002e040f, 0x002e0510, 0x002e0611, 0x002e090f, 0x002e0a10,
+    0x002e0b11, 0x002e0c0f, 0x002e0d10, 0x002e0e11, 0x002e170c, 0x002e1811, 0x002e1a0c, 0x002e1b11,
+    0x002e1c0f, 0x002e1d10, 0x002e1e11, 0x002e200f, 0x002e2110, 0x002e220d, 0x002e230e, 0x002e240d,
+    0x002e250e, 0x002e260d, 0x002e270e, 0x002e280d, 0x002e290e, 0x002e2a11, 0x002e2f03, 0x002e3011,
+    0x002e3a0c, 0x002e3c11, 0x002e400c, 0x002e4111, 0x002e420d, 0x002e4311, 0x002e5015, 0x002e5211,
+    0x002e550d, 0x002e560e, 0x002e570d, 0x002e580e, 0x002e590d, 0x002e5a0e, 0x002e5b0d, 0x002e5c0e,
+    0x002e5d0c, 0x002e5e1d, 0x002e8015, 0x002e9a1d, 0x002e9b15, 0x002ef41d, 0x002f0015, 0x002fd61d,
+    0x002ff015, 0x002ffc1d, 0x00300016, 0x00300111, 0x00300415, 0x00300503, 0x00300604, 0x00300709,
+    0x0030080d, 0x0030090e, 0x00300a0d, 0x00300b0e, 0x00300c0d, 0x00300d0e, 0x00300e0d, 0x00300f0e,
+    0x0030100d, 0x0030110e, 0x00301215, 0x0030140d, 0x0030150e, 0x0030160d, 0x0030170e, 0x0030180d,
+    0x0030190e, 0x00301a0d, 0x00301b0e, 0x00301c0c, 0x00301d0d, 0x00301e0e, 0x00302015, 0x00302109,
+    0x00302a05, 0x00302e06, 0x0030300c, 0x00303103, 0x00303615, 0x00303809, 0x00303b03, 0x00303c04,
+    0x00303d11, 0x00303e15, 0x0030401d, 0x00304104, 0x0030971d, 0x00309905, 0x00309b14, 0x00309d03,
+    0x00309f04, 0x0030a00c, 0x0030a104, 0x0030fb11, 0x0030fc03, 0x0030ff04, 0x0031001d, 0x00310504,
+    0x0031301d, 0x00313104, 0x00318f1d, 0x00319015, 0x0031920a, 0x00319615, 0x0031a004, 0x0031c015,
+    0x0031e41d, 0x0031f004, 0x00320015, 0x00321f1d, 0x0032200a, 0x00322a15, 0x0032480a, 0x00325015,
+    0x0032510a, 0x00326015, 0x0032800a, 0x00328a15, 0x0032b10a, 0x0032c015, 0x00340004, 0x004dc015,
+    0x004e0004, 0x00a01503, 0x00a01604, 0x00a48d1d, 0x00a49015, 0x00a4c71d, 0x00a4d004, 0x00a4f803,
+    0x00a4fe11, 0x00a50004, 0x00a60c03, 0x00a60d11, 0x00a61004, 0x00a62008, 0x00a62a04, 0x00a62c1d,
+    0x00a64000, 0x00a64101, 0x00a64200, 0x00a64301, 0x00a64400, 0x00a64501, 0x00a64600, 0x00a64701,
+    0x00a64800, 0x00a64901, 0x00a64a00, 0x00a64b01, 0x00a64c00, 0x00a64d01, 0x00a64e00, 0x00a64f01,
+    0x00a65000, 0x00a65101, 0x00a65200, 0x00a65301, 0x00a65400, 0x00a65501, 0x00a65600, 0x00a65701,
+    0x00a65800, 0x00a65901, 0x00a65a00, 0x00a65b01, 0x00a65c00, 0x00a65d01, 0x00a65e00, 0x00a65f01,
+    0x00a66000, 0x00a66101, 0x00a66200, 0x00a66301, 0x00a66400, 0x00a66501, 0x00a66600, 0x00a66701,
+    0x00a66800, 0x00a66901, 0x00a66a00, 0x00a66b01, 0x00a66c00, 0x00a66d01, 0x00a66e04, 0x00a66f05,
+    0x00a67007, 0x00a67311, 0x00a67405, 0x00a67e11, 0x00a67f03, 0x00a68000, 0x00a68101, 0x00a68200,
+    0x00a68301, 0x00a68400, 0x00a68501, 0x00a68600, 0x00a68701, 0x00a68800, 0x00a68901, 0x00a68a00,
+    0x00a68b01, 0x00a68c00, 0x00a68d01, 0x00a68e00, 0x00a68f01, 0x00a69000, 0x00a69101, 0x00a69200,
+    0x00a69301, 0x00a69400, 0x00a69501, 0x00a69600, 0x00a69701, 0x00a69800, 0x00a69901, 0x00a69a00,
+    0x00a69b01, 0x00a69c03, 0x00a69e05, 0x00a6a004, 0x00a6e609, 0x00a6f005, 0x00a6f211, 0x00a6f81d,
+    0x00a70014, 0x00a71703, 0x00a72014, 0x00a72200, 0x00a72301, 0x00a72400, 0x00a72501, 0x00a72600,
+    0x00a72701, 0x00a72800, 0x00a72901, 0x00a72a00, 0x00a72b01, 0x00a72c00, 0x00a72d01, 0x00a72e00,
+    0x00a72f01, 0x00a73200, 0x00a73301, 0x00a73400, 0x00a73501, 0x00a73600, 0x00a73701, 0x00a73800,
+    0x00a73901, 0x00a73a00, 0x00a73b01, 0x00a73c00, 0x00a73d01, 0x00a73e00, 0x00a73f01, 0x00a74000,
+    0x00a74101, 0x00a74200, 0x00a74301, 0x00a74400, 0x00a74501, 0x00a74600, 0x00a74701, 0x00a74800,
+    0x00a74901, 0x00a74a00, 0x00a74b01, 0x00a74c00, 0x00a74d01, 0x00a74e00, 0x00a74f01, 0x00a75000,
+    0x00a75101, 0x00a75200, 0x00a75301, 0x00a75400, 0x00a75501, 0x00a75600, 0x00a75701, 0x00a75800,
+    0x00a75901, 0x00a75a00, 0x00a75b01, 0x00a75c00, 0x00a75d01, 0x00a75e00, 0x00a75f01, 0x00a76000,
+    0x00a76101, 0x00a76200, 0x00a76301, 0x00a76400, 0x00a76501, 0x00a76600, 0x00a76701, 0x00a76800,
+    0x00a76901, 0x00a76a00, 0x00a76b01, 0x00a76c00, 0x00a76d01, 0x00a76e00, 0x00a76f01, 0x00a77003,
+    0x00a77101, 0x00a77900, 0x00a77a01, 0x00a77b00, 0x00a77c01, 0x00a77d00, 0x00a77f01, 0x00a78000,
+    0x00a78101, 0x00a78200, 0x00a78301, 0x00a78400, 0x00a78501, 0x00a78600, 0x00a78701, 0x00a78803,
+    0x00a78914, 0x00a78b00, 0x00a78c01, 0x00a78d00, 0x00a78e01, 0x00a78f04, 0x00a79000, 0x00a79101,
+    0x00a79200, 0x00a79301, 0x00a79600, 0x00a79701, 0x00a79800, 0x00a79901, 0x00a79a00, 0x00a79b01,
+    0x00a79c00, 0x00a79d01, 0x00a79e00, 0x00a79f01, 0x00a7a000, 0x00a7a101, 0x00a7a200, 0x00a7a301,
+    0x00a7a400, 0x00a7a501, 0x00a7a600, 0x00a7a701, 0x00a7a800, 0x00a7a901, 0x00a7aa00, 0x00a7af01,
+    0x00a7b000, 0x00a7b501, 0x00a7b600, 0x00a7b701, 0x00a7b800, 0x00a7b901, 0x00a7ba00, 0x00a7bb01,
+    0x00a7bc00, 0x00a7bd01, 0x00a7be00, 0x00a7bf01, 0x00a7c000, 0x00a7c101, 0x00a7c200, 0x00a7c301,
+    0x00a7c400, 0x00a7c801, 0x00a7c900, 0x00a7ca01, 0x00a7cb1d, 0x00a7d000, 0x00a7d101, 0x00a7d21d,
+    0x00a7d301, 0x00a7d41d, 0x00a7d501, 0x00a7d600, 0x00a7d701, 0x00a7d800, 0x00a7d901, 0x00a7da1d,
+    0x00a7f203, 0x00a7f500, 0x00a7f601, 0x00a7f704, 0x00a7f803, 0x00a7fa01, 0x00a7fb04, 0x00a80205,
+    0x00a80304, 0x00a80605, 0x00a80704, 0x00a80b05, 0x00a80c04, 0x00a82306, 0x00a82505, 0x00a82706,
+    0x00a82815, 0x00a82c05, 0x00a82d1d, 0x00a8300a, 0x00a83615, 0x00a83813, 0x00a83915, 0x00a83a1d,
+    0x00a84004, 0x00a87411, 0x00a8781d, 0x00a88006, 0x00a88204, 0x00a8b406, 0x00a8c405, 0x00a8c61d,
+    0x00a8ce11, 0x00a8d008, 0x00a8da1d, 0x00a8e005, 0x00a8f204, 0x00a8f811, 0x00a8fb04, 0x00a8fc11,
+    0x00a8fd04, 0x00a8ff05, 0x00a90008, 0x00a90a04, 0x00a92605, 0x00a92e11, 0x00a93004, 0x00a94705,
+    0x00a95206, 0x00a9541d, 0x00a95f11, 0x00a96004, 0x00a97d1d, 0x00a98005, 0x00a98306, 0x00a98404,
+    0x00a9b305, 0x00a9b406, 0x00a9b605, 0x00a9ba06, 0x00a9bc05, 0x00a9be06, 0x00a9c111, 0x00a9ce1d,
+    0x00a9cf03, 0x00a9d008, 0x00a9da1d, 0x00a9de11, 0x00a9e004, 0x00a9e505, 0x00a9e603, 0x00a9e704,
+    0x00a9f008, 0x00a9fa04, 0x00a9ff1d, 0x00aa0004, 0x00aa2905, 0x00aa2f06, 0x00aa3105, 0x00aa3306,
+    0x00aa3505, 0x00aa371d, 0x00aa4004, 0x00aa4305, 0x00aa4404, 0x00aa4c05, 0x00aa4d06, 0x00aa4e1d,
+    0x00aa5008, 0x00aa5a1d, 0x00aa5c11, 0x00aa6004, 0x00aa7003, 0x00aa7104, 0x00aa7715, 0x00aa7a04,
+    0x00aa7b06, 0x00aa7c05, 0x00aa7d06, 0x00aa7e04, 0x00aab005, 0x00aab104, 0x00aab205, 0x00aab504,
+    0x00aab705, 0x00aab904, 0x00aabe05, 0x00aac004, 0x00aac105, 0x00aac204, 0x00aac31d, 0x00aadb04,
+    0x00aadd03, 0x00aade11, 0x00aae004, 0x00aaeb06, 0x00aaec05, 0x00aaee06, 0x00aaf011, 0x00aaf204,
+    0x00aaf303, 0x00aaf506, 0x00aaf605, 0x00aaf71d, 0x00ab0104, 0x00ab071d, 0x00ab0904, 0x00ab0f1d,
+    0x00ab1104, 0x00ab171d, 0x00ab2004, 0x00ab271d, 0x00ab2804, 0x00ab2f1d, 0x00ab3001, 0x00ab5b14,
+    0x00ab5c03, 0x00ab6001, 0x00ab6903, 0x00ab6a14, 0x00ab6c1d, 0x00ab7001, 0x00abc004, 0x00abe306,
+    0x00abe505, 0x00abe606, 0x00abe805, 0x00abe906, 0x00abeb11, 0x00abec06, 0x00abed05, 0x00abee1d,
+    0x00abf008, 0x00abfa1d, 0x00ac0004, 0x00d7a41d, 0x00d7b004, 0x00d7c71d, 0x00d7cb04, 0x00d7fc1d,
+    0x00d8001b, 0x00e0001c, 0x00f90004, 0x00fa6e1d, 0x00fa7004, 0x00fada1d, 0x00fb0001, 0x00fb071d,
+    0x00fb1301, 0x00fb181d, 0x00fb1d04, 0x00fb1e05, 0x00fb1f04, 0x00fb2912, 0x00fb2a04, 0x00fb371d,
+    0x00fb3804, 0x00fb3d1d, 0x00fb3e04, 0x00fb3f1d, 0x00fb4004, 0x00fb421d, 0x00fb4304, 0x00fb451d,
+    0x00fb4604, 0x00fbb214, 0x00fbc31d, 0x00fbd304, 0x00fd3e0e, 0x00fd3f0d, 0x00fd4015, 0x00fd5004,
+    0x00fd901d, 0x00fd9204, 0x00fdc81d, 0x00fdcf15, 0x00fdd01d, 0x00fdf004, 0x00fdfc13, 0x00fdfd15,
+    0x00fe0005, 0x00fe1011, 0x00fe170d, 0x00fe180e, 0x00fe1911, 0x00fe1a1d, 0x00fe2005, 0x00fe3011,
+    0x00fe310c, 0x00fe330b, 0x00fe350d, 0x00fe360e, 0x00fe370d, 0x00fe380e, 0x00fe390d, 0x00fe3a0e,
+    0x00fe3b0d, 0x00fe3c0e, 0x00fe3d0d, 0x00fe3e0e, 0x00fe3f0d, 0x00fe400e, 0x00fe410d, 0x00fe420e,
+    0x00fe430d, 0x00fe440e, 0x00fe4511, 0x00fe470d, 0x00fe480e, 0x00fe4911, 0x00fe4d0b, 0x00fe5011,
+    0x00fe531d, 0x00fe5411, 0x00fe580c, 0x00fe590d, 0x00fe5a0e, 0x00fe5b0d, 0x00fe5c0e, 0x00fe5d0d,
+    0x00fe5e0e, 0x00fe5f11, 0x00fe6212, 0x00fe630c, 0x00fe6412, 0x00fe671d, 0x00fe6811, 0x00fe6913,
+    0x00fe6a11, 0x00fe6c1d, 0x00fe7004, 0x00fe751d, 0x00fe7604, 0x00fefd1d, 0x00feff1a, 0x00ff001d,
+    0x00ff0111, 0x00ff0413, 0x00ff0511, 0x00ff080d, 0x00ff090e, 0x00ff0a11, 0x00ff0b12, 0x00ff0c11,
+    0x00ff0d0c, 0x00ff0e11, 0x00ff1008, 0x00ff1a11, 0x00ff1c12, 0x00ff1f11, 0x00ff2100, 0x00ff3b0d,
+    0x00ff3c11, 0x00ff3d0e, 0x00ff3e14, 0x00ff3f0b, 0x00ff4014, 0x00ff4101, 0x00ff5b0d, 0x00ff5c12,
+    0x00ff5d0e, 0x00ff5e12, 0x00ff5f0d, 0x00ff600e, 0x00ff6111, 0x00ff620d, 0x00ff630e, 0x00ff6411,
+    0x00ff6604, 0x00ff7003, 0x00ff7104, 0x00ff9e03, 0x00ffa004, 0x00ffbf1d, 0x00ffc204, 0x00ffc81d,
+    0x00ffca04, 0x00ffd01d, 0x00ffd204, 0x00ffd81d, 0x00ffda04, 0x00ffdd1d, 0x00ffe013, 0x00ffe212,
+    0x00ffe314, 0x00ffe415, 0x00ffe513, 0x00ffe71d, 0x00ffe815, 0x00ffe912, 0x00ffed15, 0x00ffef1d,
+    0x00fff91a, 0x00fffc15, 0x00fffe1d, 0x01000004, 0x01000c1d, 0x01000d04, 0x0100271d, 0x01002804,
+    0x01003b1d, 0x01003c04, 0x01003e1d, 0x01003f04, 0x01004e1d, 0x01005004, 0x01005e1d, 0x01008004,
+    0x0100fb1d, 0x01010011, 0x0101031d, 0x0101070a, 0x0101341d, 0x01013715, 0x01014009, 0x0101750a,
+    0x01017915, 0x01018a0a, 0x01018c15, 0x01018f1d, 0x01019015, 0x01019d1d, 0x0101a015, 0x0101a11d,
+    0x0101d015, 0x0101fd05, 0x0101fe1d, 0x01028004, 0x01029d1d, 0x0102a004, 0x0102d11d, 0x0102e005,
+    0x0102e10a, 0x0102fc1d, 0x01030004, 0x0103200a, 0x0103241d, 0x01032d04, 0x01034109, 0x01034204,
+    0x01034a09, 0x01034b1d, 0x01035004, 0x01037605, 0x01037b1d, 0x01038004, 0x01039e1d, 0x01039f11,
+    0x0103a004, 0x0103c41d, 0x0103c804, 0x0103d011, 0x0103d109, 0x0103d61d, 0x01040000, 0x01042801,
+    0x01045004, 0x01049e1d, 0x0104a008, 0x0104aa1d, 0x0104b000, 0x0104d41d, 0x0104d801, 0x0104fc1d,
+    0x01050004, 0x0105281d, 0x01053004, 0x0105641d, 0x01056f11, 0x01057000, 0x01057b1d, 0x01057c00,
+    0x01058b1d, 0x01058c00, 0x0105931d, 0x01059400, 0x0105961d, 0x01059701, 0x0105a21d, 0x0105a301,
+    0x0105b21d, 0x0105b301, 0x0105ba1d, 0x0105bb01, 0x0105bd1d, 0x01060004, 0x0107371d, 0x01074004,
+    0x0107561d, 0x01076004, 0x0107681d, 0x01078003, 0x0107861d, 0x01078703, 0x0107b11d, 0x0107b203,
+    0x0107bb1d, 0x01080004, 0x0108061d, 0x01080804, 0x0108091d, 0x01080a04, 0x0108361d, 0x01083704,
+    0x0108391d, 0x01083c04, 0x01083d1d, 0x01083f04, 0x0108561d, 0x01085711, 0x0108580a, 0x01086004,
+    0x01087715, 0x0108790a, 0x01088004, 0x01089f1d, 0x0108a70a, 0x0108b01d, 0x0108e004, 0x0108f31d,
+    0x0108f404, 0x0108f61d, 0x0108fb0a, 0x01090004, 0x0109160a, 0x01091c1d, 0x01091f11, 0x01092004,
+    0x01093a1d, 0x01093f11, 0x0109401d, 0x01098004, 0x0109b81d, 0x0109bc0a, 0x0109be04, 0x0109c00a,
+    0x0109d01d, 0x0109d20a, 0x010a0004, 0x010a0105, 0x010a041d, 0x010a0505, 0x010a071d, 0x010a0c05,
+    0x010a1004, 0x010a141d, 0x010a1504, 0x010a181d, 0x010a1904, 0x010a361d, 0x010a3805, 0x010a3b1d,
+    0x010a3f05, 0x010a400a, 0x010a491d, 0x010a5011, 0x010a591d, 0x010a6004, 0x010a7d0a, 0x010a7f11,
+    0x010a8004, 0x010a9d0a, 0x010aa01d, 0x010ac004, 0x010ac815, 0x010ac904, 0x010ae505, 0x010ae71d,
+    0x010aeb0a, 0x010af011, 0x010af71d, 0x010b0004, 0x010b361d, 0x010b3911, 0x010b4004, 0x010b561d,
+    0x010b580a, 0x010b6004, 0x010b731d, 0x010b780a, 0x010b8004, 0x010b921d, 0x010b9911, 0x010b9d1d,
+    0x010ba90a, 0x010bb01d, 0x010c0004, 0x010c491d, 0x010c8000, 0x010cb31d, 0x010cc001, 0x010cf31d,
+    0x010cfa0a, 0x010d0004, 0x010d2405, 0x010d281d, 0x010d3008, 0x010d3a1d, 0x010e600a, 0x010e7f1d,
+    0x010e8004, 0x010eaa1d, 0x010eab05, 0x010ead0c, 0x010eae1d, 0x010eb004, 0x010eb21d, 0x010f0004,
+    0x010f1d0a, 0x010f2704, 0x010f281d, 0x010f3004, 0x010f4605, 0x010f510a, 0x010f5511, 0x010f5a1d,
+    0x010f7004, 0x010f8205, 0x010f8611, 0x010f8a1d, 0x010fb004, 0x010fc50a, 0x010fcc1d, 0x010fe004,
+    0x010ff71d, 0x01100006, 0x01100105, 0x01100206, 0x01100304, 0x01103805, 0x01104711, 0x01104e1d,
+    0x0110520a, 0x01106608, 0x01107005, 0x01107104, 0x01107305, 0x01107504, 0x0110761d, 0x01107f05,
+    0x01108206, 0x01108304, 0x0110b006, 0x0110b305, 0x0110b706, 0x0110b905, 0x0110bb11, 0x0110bd1a,
+    0x0110be11, 0x0110c205, 0x0110c31d, 0x0110cd1a, 0x0110ce1d, 0x0110d004, 0x0110e91d, 0x0110f008,
+    0x0110fa1d, 0x01110005, 0x01110304, 0x01112705, 0x01112c06, 0x01112d05, 0x0111351d, 0x01113608,
+    0x01114011, 0x01114404, 0x01114506, 0x01114704, 0x0111481d, 0x01115004, 0x01117305, 0x01117411,
+    0x01117604, 0x0111771d, 0x01118005, 0x01118206, 0x01118304, 0x0111b306, 0x0111b605, 0x0111bf06,
+    0x0111c104, 0x0111c511, 0x0111c905, 0x0111cd11, 0x0111ce06, 0x0111cf05, 0x0111d008, 0x0111da04,
+    0x0111db11, 0x0111dc04, 0x0111dd11, 0x0111e01d, 0x0111e10a, 0x0111f51d, 0x01120004, 0x0112121d,
+    0x01121304, 0x01122c06, 0x01122f05, 0x01123206, 0x01123405, 0x01123506, 0x01123605, 0x01123811,
+    0x01123e05, 0x01123f1d, 0x01128004, 0x0112871d, 0x01128804, 0x0112891d, 0x01128a04, 0x01128e1d,
+    0x01128f04, 0x01129e1d, 0x01129f04, 0x0112a911, 0x0112aa1d, 0x0112b004, 0x0112df05, 0x0112e006,
+    0x0112e305, 0x0112eb1d, 0x0112f008, 0x0112fa1d, 0x01130005, 0x01130206, 0x0113041d, 0x01130504,
+    0x01130d1d, 0x01130f04, 0x0113111d, 0x01131304, 0x0113291d, 0x01132a04, 0x0113311d, 0x01133204,
+    0x0113341d, 0x01133504, 0x01133a1d, 0x01133b05, 0x01133d04, 0x01133e06, 0x01134005, 0x01134106,
+    0x0113451d, 0x01134706, 0x0113491d, 0x01134b06, 0x01134e1d, 0x01135004, 0x0113511d, 0x01135706,
+    0x0113581d, 0x01135d04, 0x01136206, 0x0113641d, 0x01136605, 0x01136d1d, 0x01137005, 0x0113751d,
+    0x01140004, 0x01143506, 0x01143805, 0x01144006, 0x01144205, 0x01144506, 0x01144605, 0x01144704,
+    0x01144b11, 0x01145008, 0x01145a11, 0x01145c1d, 0x01145d11, 0x01145e05, 0x01145f04, 0x0114621d,
+    0x01148004, 0x0114b006, 0x0114b305, 0x0114b906, 0x0114ba05, 0x0114bb06, 0x0114bf05, 0x0114c106,
+    0x0114c205, 0x0114c404, 0x0114c611, 0x0114c704, 0x0114c81d, 0x0114d008, 0x0114da1d, 0x01158004,
+    0x0115af06, 0x0115b205, 0x0115b61d, 0x0115b806, 0x0115bc05, 0x0115be06, 0x0115bf05, 0x0115c111,
+    0x0115d804, 0x0115dc05, 0x0115de1d, 0x01160004, 0x01163006, 0x01163305, 0x01163b06, 0x01163d05,
+    0x01163e06, 0x01163f05, 0x01164111, 0x01164404, 0x0116451d, 0x01165008, 0x01165a1d, 0x01166011,
+    0x01166d1d, 0x01168004, 0x0116ab05, 0x0116ac06, 0x0116ad05, 0x0116ae06, 0x0116b005, 0x0116b606,
+    0x0116b705, 0x0116b804, 0x0116b911, 0x0116ba1d, 0x0116c008, 0x0116ca1d, 0x01170004, 0x01171b1d,
+    0x01171d05, 0x01172006, 0x01172205, 0x01172606, 0x01172705, 0x01172c1d, 0x01173008, 0x01173a0a,
+    0x01173c11, 0x01173f15, 0x01174004, 0x0117471d, 0x01180004, 0x01182c06, 0x01182f05, 0x01183806,
+    0x01183905, 0x01183b11, 0x01183c1d, 0x0118a000, 0x0118c001, 0x0118e008, 0x0118ea0a, 0x0118f31d,
+    0x0118ff04, 0x0119071d, 0x01190904, 0x01190a1d, 0x01190c04, 0x0119141d, 0x01191504, 0x0119171d,
+    0x01191804, 0x01193006, 0x0119361d, 0x01193706, 0x0119391d, 0x01193b05, 0x01193d06, 0x01193e05,
+    0x01193f04, 0x01194006, 0x01194104, 0x01194206, 0x01194305, 0x01194411, 0x0119471d, 0x01195008,
+    0x01195a1d, 0x0119a004, 0x0119a81d, 0x0119aa04, 0x0119d106, 0x0119d405, 0x0119d81d, 0x0119da05,
+    0x0119dc06, 0x0119e005, 0x0119e104, 0x0119e211, 0x0119e304, 0x0119e406, 0x0119e51d, 0x011a0004,
+    0x011a0105, 0x011a0b04, 0x011a3305, 0x011a3906, 0x011a3a04, 0x011a3b05, 0x011a3f11, 0x011a4705,
+    0x011a481d, 0x011a5004, 0x011a5105, 0x011a5706, 0x011a5905, 0x011a5c04, 0x011a8a05, 0x011a9706,
+    0x011a9805, 0x011a9a11, 0x011a9d04, 0x011a9e11, 0x011aa31d, 0x011ab004, 0x011af91d, 0x011c0004,
+    0x011c091d, 0x011c0a04, 0x011c2f06, 0x011c3005, 0x011c371d, 0x011c3805, 0x011c3e06, 0x011c3f05,
+    0x011c4004, 0x011c4111, 0x011c461d, 0x011c5008, 0x011c5a0a, 0x011c6d1d, 0x011c7011, 0x011c7204,
+    0x011c901d, 0x011c9205, 0x011ca81d, 0x011ca906, 0x011caa05, 0x011cb106, 0x011cb205, 0x011cb406,
+    0x011cb505, 0x011cb71d, 0x011d0004, 0x011d071d, 0x011d0804, 0x011d0a1d, 0x011d0b04, 0x011d3105,
+    0x011d371d, 0x011d3a05, 0x011d3b1d, 0x011d3c05, 0x011d3e1d, 0x011d3f05, 0x011d4604, 0x011d4705,
+    0x011d481d, 0x011d5008, 0x011d5a1d, 0x011d6004, 0x011d661d, 0x011d6704, 0x011d691d, 0x011d6a04,
+    0x011d8a06, 0x011d8f1d, 0x011d9005, 0x011d921d, 0x011d9306, 0x011d9505, 0x011d9606, 0x011d9705,
+    0x011d9804, 0x011d991d, 0x011da008, 0x011daa1d, 0x011ee004, 0x011ef305, 0x011ef506, 0x011ef711,
+    0x011ef91d, 0x011fb004, 0x011fb11d, 0x011fc00a, 0x011fd515, 0x011fdd13, 0x011fe115, 0x011ff21d,
+    0x011fff11, 0x01200004, 0x01239a1d, 0x01240009, 0x01246f1d, 0x01247011, 0x0124751d, 0x01248004,
+    0x0125441d, 0x012f9004, 0x012ff111, 0x012ff31d, 0x01300004, 0x01342f1d, 0x0134301a, 0x0134391d,
+    0x01440004, 0x0146471d, 0x01680004, 0x016a391d, 0x016a4004, 0x016a5f1d, 0x016a6008, 0x016a6a1d,
+    0x016a6e11, 0x016a7004, 0x016abf1d, 0x016ac008, 0x016aca1d, 0x016ad004, 0x016aee1d, 0x016af005,
+    0x016af511, 0x016af61d, 0x016b0004, 0x016b3005, 0x016b3711, 0x016b3c15, 0x016b4003, 0x016b4411,
+    0x016b4515, 0x016b461d, 0x016b5008, 0x016b5a1d, 0x016b5b0a, 0x016b621d, 0x016b6304, 0x016b781d,
+    0x016b7d04, 0x016b901d, 0x016e4000, 0x016e6001, 0x016e800a, 0x016e9711, 0x016e9b1d, 0x016f0004,
+    0x016f4b1d, 0x016f4f05, 0x016f5004, 0x016f5106, 0x016f881d, 0x016f8f05, 0x016f9303, 0x016fa01d,
+    0x016fe003, 0x016fe211, 0x016fe303, 0x016fe405, 0x016fe51d, 0x016ff006, 0x016ff21d, 0x01700004,
+    0x0187f81d, 0x01880004, 0x018cd61d, 0x018d0004, 0x018d091d, 0x01aff003, 0x01aff41d, 0x01aff503,
+    0x01affc1d, 0x01affd03, 0x01afff1d, 0x01b00004, 0x01b1231d, 0x01b15004, 0x01b1531d, 0x01b16404,
+    0x01b1681d, 0x01b17004, 0x01b2fc1d, 0x01bc0004, 0x01bc6b1d, 0x01bc7004, 0x01bc7d1d, 0x01bc8004,
+    0x01bc891d, 0x01bc9004, 0x01bc9a1d, 0x01bc9c15, 0x01bc9d05, 0x01bc9f11, 0x01bca01a, 0x01bca41d,
+    0x01cf0005, 0x01cf2e1d, 0x01cf3005, 0x01cf471d, 0x01cf5015, 0x01cfc41d, 0x01d00015, 0x01d0f61d,
+    0x01d10015, 0x01d1271d, 0x01d12915, 0x01d16506, 0x01d16705, 0x01d16a15, 0x01d16d06, 0x01d1731a,
+    0x01d17b05, 0x01d18315, 0x01d18505, 0x01d18c15, 0x01d1aa05, 0x01d1ae15, 0x01d1eb1d, 0x01d20015,
+    0x01d24205, 0x01d24515, 0x01d2461d, 0x01d2e00a, 0x01d2f41d, 0x01d30015, 0x01d3571d, 0x01d3600a,
+    0x01d3791d, 0x01d40000, 0x01d41a01, 0x01d43400, 0x01d44e01, 0x01d4551d, 0x01d45601, 0x01d46800,
+    0x01d48201, 0x01d49c00, 0x01d49d1d, 0x01d49e00, 0x01d4a01d, 0x01d4a200, 0x01d4a31d, 0x01d4a500,
+    0x01d4a71d, 0x01d4a900, 0x01d4ad1d, 0x01d4ae00, 0x01d4b601, 0x01d4ba1d, 0x01d4bb01, 0x01d4bc1d,
+    0x01d4bd01, 0x01d4c41d, 0x01d4c501, 0x01d4d000, 0x01d4ea01, 0x01d50400, 0x01d5061d, 0x01d50700,
+    0x01d50b1d, 0x01d50d00, 0x01d5151d, 0x01d51600, 0x01d51d1d, 0x01d51e01, 0x01d53800, 0x01d53a1d,
+    0x01d53b00, 0x01d53f1d, 0x01d54000, 0x01d5451d, 0x01d54600, 0x01d5471d, 0x01d54a00, 0x01d5511d,
+    0x01d55201, 0x01d56c00, 0x01d58601, 0x01d5a000, 0x01d5ba01, 0x01d5d400, 0x01d5ee01, 0x01d60800,
+    0x01d62201, 0x01d63c00, 0x01d65601, 0x01d67000, 0x01d68a01, 0x01d6a61d, 0x01d6a800, 0x01d6c112,
+    0x01d6c201, 0x01d6db12, 0x01d6dc01, 0x01d6e200, 0x01d6fb12, 0x01d6fc01, 0x01d71512, 0x01d71601,
+    0x01d71c00, 0x01d73512, 0x01d73601, 0x01d74f12, 0x01d75001, 0x01d75600, 0x01d76f12, 0x01d77001,
+    0x01d78912, 0x01d78a01, 0x01d79000, 0x01d7a912, 0x01d7aa01, 0x01d7c312, 0x01d7c401, 0x01d7ca00,
+    0x01d7cb01, 0x01d7cc1d, 0x01d7ce08, 0x01d80015, 0x01da0005, 0x01da3715, 0x01da3b05, 0x01da6d15,
+    0x01da7505, 0x01da7615, 0x01da8405, 0x01da8515, 0x01da8711, 0x01da8c1d, 0x01da9b05, 0x01daa01d,
+    0x01daa105, 0x01dab01d, 0x01df0001, 0x01df0a04, 0x01df0b01, 0x01df1f1d, 0x01e00005, 0x01e0071d,
+    0x01e00805, 0x01e0191d, 0x01e01b05, 0x01e0221d, 0x01e02305, 0x01e0251d, 0x01e02605, 0x01e02b1d,
+    0x01e10004, 0x01e12d1d, 0x01e13005, 0x01e13703, 0x01e13e1d, 0x01e14008, 0x01e14a1d, 0x01e14e04,
+    0x01e14f15, 0x01e1501d, 0x01e29004, 0x01e2ae05, 0x01e2af1d, 0x01e2c004, 0x01e2ec05, 0x01e2f008,
+    0x01e2fa1d, 0x01e2ff13, 0x01e3001d, 0x01e7e004, 0x01e7e71d, 0x01e7e804, 0x01e7ec1d, 0x01e7ed04,
+    0x01e7ef1d, 0x01e7f004, 0x01e7ff1d, 0x01e80004, 0x01e8c51d, 0x01e8c70a, 0x01e8d005, 0x01e8d71d,
+    0x01e90000, 0x01e92201, 0x01e94405, 0x01e94b03, 0x01e94c1d, 0x01e95008, 0x01e95a1d, 0x01e95e11,
+    0x01e9601d, 0x01ec710a, 0x01ecac15, 0x01ecad0a, 0x01ecb013, 0x01ecb10a, 0x01ecb51d, 0x01ed010a,
+    0x01ed2e15, 0x01ed2f0a, 0x01ed3e1d, 0x01ee0004, 0x01ee041d, 0x01ee0504, 0x01ee201d, 0x01ee2104,
+    0x01ee231d, 0x01ee2404, 0x01ee251d, 0x01ee2704, 0x01ee281d, 0x01ee2904, 0x01ee331d, 0x01ee3404,
+    0x01ee381d, 0x01ee3904, 0x01ee3a1d, 0x01ee3b04, 0x01ee3c1d, 0x01ee4204, 0x01ee431d, 0x01ee4704,
+    0x01ee481d, 0x01ee4904, 0x01ee4a1d, 0x01ee4b04, 0x01ee4c1d, 0x01ee4d04, 0x01ee501d, 0x01ee5104,
+    0x01ee531d, 0x01ee5404, 0x01ee551d, 0x01ee5704, 0x01ee581d, 0x01ee5904, 0x01ee5a1d, 0x01ee5b04,
+    0x01ee5c1d, 0x01ee5d04, 0x01ee5e1d, 0x01ee5f04, 0x01ee601d, 0x01ee6104, 0x01ee631d, 0x01ee6404,
+    0x01ee651d, 0x01ee6704, 0x01ee6b1d, 0x01ee6c04, 0x01ee731d, 0x01ee7404, 0x01ee781d, 0x01ee7904,
+    0x01ee7d1d, 0x01ee7e04, 0x01ee7f1d, 0x01ee8004, 0x01ee8a1d, 0x01ee8b04, 0x01ee9c1d, 0x01eea104,
+    0x01eea41d, 0x01eea504, 0x01eeaa1d, 0x01eeab04, 0x01eebc1d, 0x01eef012, 0x01eef21d, 0x01f00015,
+    0x01f02c1d, 0x01f03015, 0x01f0941d, 0x01f0a015, 0x01f0af1d, 0x01f0b115, 0x01f0c01d, 0x01f0c115,
+    0x01f0d01d, 0x01f0d115, 0x01f0f61d, 0x01f1000a, 0x01f10d15, 0x01f1ae1d, 0x01f1e615, 0x01f2031d,
+    0x01f21015, 0x01f23c1d, 0x01f24015, 0x01f2491d, 0x01f25015, 0x01f2521d, 0x01f26015, 0x01f2661d,
+    0x01f30015, 0x01f3fb14, 0x01f40015, 0x01f6d81d, 0x01f6dd15, 0x01f6ed1d, 0x01f6f015, 0x01f6fd1d,
+    0x01f70015, 0x01f7741d, 0x01f78015, 0x01f7d91d, 0x01f7e015, 0x01f7ec1d, 0x01f7f015, 0x01f7f11d,
+    0x01f80015, 0x01f80c1d, 0x01f81015, 0x01f8481d, 0x01f85015, 0x01f85a1d, 0x01f86015, 0x01f8881d,
+    0x01f89015, 0x01f8ae1d, 0x01f8b015, 0x01f8b21d, 0x01f90015, 0x01fa541d, 0x01fa6015, 0x01fa6e1d,
+    0x01fa7015, 0x01fa751d, 0x01fa7815, 0x01fa7d1d, 0x01fa8015, 0x01fa871d, 0x01fa9015, 0x01faad1d,
+    0x01fab015, 0x01fabb1d, 0x01fac015, 0x01fac61d, 0x01fad015, 0x01fada1d, 0x01fae015, 0x01fae81d,
+    0x01faf015, 0x01faf71d, 0x01fb0015, 0x01fb931d, 0x01fb9415, 0x01fbcb1d, 0x01fbf008, 0x01fbfa1d,
+    0x02000004, 0x02a6e01d, 0x02a70004, 0x02b7391d, 0x02b74004, 0x02b81e1d, 0x02b82004, 0x02cea21d,
+    0x02ceb004, 0x02ebe11d, 0x02f80004, 0x02fa1e1d, 0x03000004, 0x03134b1d, 0x0e00011a, 0x0e00021d,
+    0x0e00201a, 0x0e00801d, 0x0e010005, 0x0e01f01d, 0x0f00001c, 0x0ffffe1d, 0x1000001c, 0x10fffe1d,
+};
+
+static const uint32_t ScriptRuns[] =
+{
+    0x00000019, 0x00004146, 0x00005b19, 0x00006146, 0x00007b19, 0x0000aa46, 0x0000ab19, 0x0000ba46,
+    0x0000bb19, 0x0000c046, 0x0000d719, 0x0000d846, 0x0000f719, 0x0000f846, 0x0002b919, 0x0002e046,
+    0x0002e519, 0x0002ea0d, 0x0002ec19, 0x00030038, 0x0003702c, 0x00037419, 0x0003752c, 0x00037800,
+    0x00037a2c, 0x00037e19, 0x00037f2c, 0x00038000, 0x0003842c, 0x00038519, 0x0003862c, 0x00038719,
+    0x0003882c, 0x00038b00, 0x00038c2c, 0x00038d00, 0x00038e2c, 0x0003a200, 0x0003a32c, 0x0003e21a,
+    0x0003f02c, 0x0004001e, 0x00048538, 0x0004871e, 0x00053000, 0x00053105, 0x00055700, 0x00055905,
+    0x00058b00, 0x00058d05, 0x00059000, 0x00059135, 0x0005c800, 0x0005d035, 0x0005eb00, 0x0005ef35,
+    0x0005f500, 0x00060004, 0x00060519, 0x00060604, 0x00060c19, 0x00060d04, 0x00061b19, 0x00061c04,
+    0x00061f19, 0x00062004, 0x00064019, 0x00064104, 0x00064b38, 0x00065604, 0x00067038, 0x00067104,
+    0x0006dd19, 0x0006de04, 0x00070089, 0x00070e00, 0x00070f89, 0x00074b00, 0x00074d89, 0x00075004,
+    0x00078094, 0x0007b200, 0x0007c064, 0x0007fb00, 0x0007fd64, 0x0008007d, 0x00082e00, 0x0008307d,
+    0x00083f00, 0x00084051, 0x00085c00, 0x00085e51, 0x00085f00, 0x00086089, 0x00086b00, 0x00087004,
+    0x00088f00, 0x00089004, 0x00089200, 0x00089804, 0x0008e219, 0x0008e304, 0x00090020, 0x00095138,
+    0x00095520, 0x00096419, 0x00096620, 0x0009800b, 0x00098400, 0x0009850b, 0x00098d00, 0x00098f0b,
+    0x00099100, 0x0009930b, 0x0009a900, 0x0009aa0b, 0x0009b100, 0x0009b20b, 0x0009b300, 0x0009b60b,
+    0x0009ba00, 0x0009bc0b, 0x0009c500, 0x0009c70b, 0x0009c900, 0x0009cb0b, 0x0009cf00, 0x0009d70b,
+    0x0009d800, 0x0009dc0b, 0x0009de00, 0x0009df0b, 0x0009e400, 0x0009e60b, 0x0009ff00, 0x000a012f,
+    0x000a0400, 0x000a052f, 0x000a0b00, 0x000a0f2f, 0x000a1100, 0x000a132f, 0x000a2900, 0x000a2a2f,
+    0x000a3100, 0x000a322f, 0x000a3400, 0x000a352f, 0x000a3700, 0x000a382f, 0x000a3a00, 0x000a3c2f,
+    0x000a3d00, 0x000a3e2f, 0x000a4300, 0x000a472f, 0x000a4900, 0x000a4b2f, 0x000a4e00, 0x000a512f,
+    0x000a5200, 0x000a592f, 0x000a5d00, 0x000a5e2f, 0x000a5f00, 0x000a662f, 0x000a7700, 0x000a812d,
+    0x000a8400, 0x000a852d, 0x000a8e00, 0x000a8f2d, 0x000a9200, 0x000a932d, 0x000aa900, 0x000aaa2d,
+    0x000ab100, 0x000ab22d, 0x000ab400, 0x000ab52d, 0x000aba00, 0x000abc2d, 0x000ac600, 0x000ac72d,
+    0x000aca00, 0x000acb2d, 0x000ace00, 0x000ad02d, 0x000ad100, 0x000ae02d, 0x000ae400, 0x000ae62d,
+    0x000af200, 0x000af92d, 0x000b0000, 0x000b0172, 0x000b0400, 0x000b0572, 0x000b0d00, 0x000b0f72,
+    0x000b1100, 0x000b1372, 0x000b2900, 0x000b2a72, 0x000b3100, 0x000b3272, 0x000b3400, 0x000b3572,
+    0x000b3a00, 0x000b3c72, 0x000b4500, 0x000b4772, 0x000b4900, 0x000b4b72, 0x000b4e00, 0x000b5572,
+    0x000b5800, 0x000b5c72, 0x000b5e00, 0x000b5f72, 0x000b6400, 0x000b6672, 0x000b7800, 0x000b8290,
+    0x000b8400, 0x000b8590, 0x000b8b00, 0x000b8e90, 0x000b9100, 0x000b9290, 0x000b9600, 0x000b9990,
+    0x000b9b00, 0x000b9c90, 0x000b9d00, 0x000b9e90, 0x000ba000, 0x000ba390, 0x000ba500, 0x000ba890,
+    0x000bab00, 0x000bae90, 0x000bba00, 0x000bbe90, 0x000bc300, 0x000bc690, 0x000bc900, 0x000bca90,
+    0x000bce00, 0x000bd090, 0x000bd100, 0x000bd790, 0x000bd800, 0x000be690, 0x000bfb00, 0x000c0093,
+    0x000c0d00, 0x000c0e93, 0x000c1100, 0x000c1293, 0x000c2900, 0x000c2a93, 0x000c3a00, 0x000c3c93,
+    0x000c4500, 0x000c4693, 0x000c4900, 0x000c4a93, 0x000c4e00, 0x000c5593, 0x000c5700, 0x000c5893,
+    0x000c5b00, 0x000c5d93, 0x000c5e00, 0x000c6093, 0x000c6400, 0x000c6693, 0x000c7000, 0x000c7793,
+    0x000c803d, 0x000c8d00, 0x000c8e3d, 0x000c9100, 0x000c923d, 0x000ca900, 0x000caa3d, 0x000cb400,
+    0x000cb53d, 0x000cba00, 0x000cbc3d, 0x000cc500, 0x000cc63d, 0x000cc900, 0x000cca3d, 0x000cce00,
+    0x000cd53d, 0x000cd700, 0x000cdd3d, 0x000cdf00, 0x000ce03d, 0x000ce400, 0x000ce63d, 0x000cf000,
+    0x000cf13d, 0x000cf300, 0x000d0050, 0x000d0d00, 0x000d0e50, 0x000d1100, 0x000d1250, 0x000d4500,
+    0x000d4650, 0x000d4900, 0x000d4a50, 0x000d5000, 0x000d5450, 0x000d6400, 0x000d6650, 0x000d8000,
+    0x000d8183, 0x000d8400, 0x000d8583, 0x000d9700, 0x000d9a83, 0x000db200, 0x000db383, 0x000dbc00,
+    0x000dbd83, 0x000dbe00, 0x000dc083, 0x000dc700, 0x000dca83, 0x000dcb00, 0x000dcf83, 0x000dd500,
+    0x000dd683, 0x000dd700, 0x000dd883, 0x000de000, 0x000de683, 0x000df000, 0x000df283, 0x000df500,
+    0x000e0195, 0x000e3b00, 0x000e3f19, 0x000e4095, 0x000e5c00, 0x000e8145, 0x000e8300, 0x000e8445,
+    0x000e8500, 0x000e8645, 0x000e8b00, 0x000e8c45, 0x000ea400, 0x000ea545, 0x000ea600, 0x000ea745,
+    0x000ebe00, 0x000ec045, 0x000ec500, 0x000ec645, 0x000ec700, 0x000ec845, 0x000ece00, 0x000ed045,
+    0x000eda00, 0x000edc45, 0x000ee000, 0x000f0096, 0x000f4800, 0x000f4996, 0x000f6d00, 0x000f7196,
+    0x000f9800, 0x000f9996, 0x000fbd00, 0x000fbe96, 0x000fcd00, 0x000fce96, 0x000fd519, 0x000fd996,
+    0x000fdb00, 0x0010005f, 0x0010a028, 0x0010c600, 0x0010c728, 0x0010c800, 0x0010cd28, 0x0010ce00,
+    0x0010d028, 0x0010fb19, 0x0010fc28, 0x00110031, 0x00120027, 0x00124900, 0x00124a27, 0x00124e00,
+    0x00125027, 0x00125700, 0x00125827, 0x00125900, 0x00125a27, 0x00125e00, 0x00126027, 0x00128900,
+    0x00128a27, 0x00128e00, 0x00129027, 0x0012b100, 0x0012b227, 0x0012b600, 0x0012b827, 0x0012bf00,
+    0x0012c027, 0x0012c100, 0x0012c227, 0x0012c600, 0x0012c827, 0x0012d700, 0x0012d827, 0x00131100,
+    0x00131227, 0x00131600, 0x00131827, 0x00135b00, 0x00135d27, 0x00137d00, 0x00138027, 0x00139a00,
+    0x0013a017, 0x0013f600, 0x0013f817, 0x0013fe00, 0x00140012, 0x00168067, 0x00169d00, 0x0016a07c,
+    0x0016eb19, 0x0016ee7c, 0x0016f900, 0x0017008a, 0x00171600, 0x00171f8a, 0x00172033, 0x00173519,
+    0x00173700, 0x00174011, 0x00175400, 0x0017608b, 0x00176d00, 0x00176e8b, 0x00177100, 0x0017728b,
+    0x00177400, 0x00178042, 0x0017de00, 0x0017e042, 0x0017ea00, 0x0017f042, 0x0017fa00, 0x0018005c,
+    0x00180219, 0x0018045c, 0x00180519, 0x0018065c, 0x00181a00, 0x0018205c, 0x00187900, 0x0018805c,
+    0x0018ab00, 0x0018b012, 0x0018f600, 0x00190048, 0x00191f00, 0x00192048, 0x00192c00, 0x00193048,
+    0x00193c00, 0x00194048, 0x00194100, 0x00194448, 0x0019508c, 0x00196e00, 0x0019708c, 0x00197500,
+    0x00198062, 0x0019ac00, 0x0019b062, 0x0019ca00, 0x0019d062, 0x0019db00, 0x0019de62, 0x0019e042,
+    0x001a0010, 0x001a1c00, 0x001a1e10, 0x001a208d, 0x001a5f00, 0x001a608d, 0x001a7d00, 0x001a7f8d,
+    0x001a8a00, 0x001a908d, 0x001a9a00, 0x001aa08d, 0x001aae00, 0x001ab038, 0x001acf00, 0x001b0007,
+    0x001b4d00, 0x001b5007, 0x001b7f00, 0x001b8087, 0x001bc00a, 0x001bf400, 0x001bfc0a, 0x001c0047,
+    0x001c3800, 0x001c3b47, 0x001c4a00, 0x001c4d47, 0x001c5068, 0x001c801e, 0x001c8900, 0x001c9028,
+    0x001cbb00, 0x001cbd28, 0x001cc087, 0x001cc800, 0x001cd038, 0x001cd319, 0x001cd438, 0x001ce119,
+    0x001ce238, 0x001ce919, 0x001ced38, 0x001cee19, 0x001cf438, 0x001cf519, 0x001cf838, 0x001cfa19,
+    0x001cfb00, 0x001d0046, 0x001d262c, 0x001d2b1e, 0x001d2c46, 0x001d5d2c, 0x001d6246, 0x001d662c,
+    0x001d6b46, 0x001d781e, 0x001d7946, 0x001dbf2c, 0x001dc038, 0x001e0046, 0x001f002c, 0x001f1600,
+    0x001f182c, 0x001f1e00, 0x001f202c, 0x001f4600, 0x001f482c, 0x001f4e00, 0x001f502c, 0x001f5800,
+    0x001f592c, 0x001f5a00, 0x001f5b2c, 0x001f5c00, 0x001f5d2c, 0x001f5e00, 0x001f5f2c, 0x001f7e00,
+    0x001f802c, 0x001fb500, 0x001fb62c, 0x001fc500, 0x001fc62c, 0x001fd400, 0x001fd62c, 0x001fdc00,
+    0x001fdd2c, 0x001ff000, 0x001ff22c, 0x001ff500, 0x001ff62c, 0x001fff00, 0x00200019, 0x00200c38,
+    0x00200e19, 0x00206500, 0x00206619, 0x00207146, 0x00207200, 0x00207419, 0x00207f46, 0x00208019,
+    0x00208f00, 0x00209046, 0x00209d00, 0x0020a019, 0x0020c100, 0x0020d038, 0x0020f100, 0x00210019,
+    0x0021262c, 0x00212719, 0x00212a46, 0x00212c19, 0x00213246, 0x00213319, 0x00214e46, 0x00214f19,
+    0x00216046, 0x00218919, 0x00218c00, 0x00219019, 0x00242700, 0x00244019, 0x00244b00, 0x00246019,
+    0x0028000f, 0x00290019, 0x002b7400, 0x002b7619, 0x002b9600, 0x002b9719, 0x002c0029, 0x002c6046,
+    0x002c801a, 0x002cf400, 0x002cf91a, 0x002d0028, 0x002d2600, 0x002d2728, 0x002d2800, 0x002d2d28,
+    0x002d2e00, 0x002d3097, 0x002d6800, 0x002d6f97, 0x002d7100, 0x002d7f97, 0x002d8027, 0x002d9700,
+    0x002da027, 0x002da700, 0x002da827, 0x002daf00, 0x002db027, 0x002db700, 0x002db827, 0x002dbf00,
+    0x002dc027, 0x002dc700, 0x002dc827, 0x002dcf00, 0x002dd027, 0x002dd700, 0x002dd827, 0x002ddf00,
+    0x002de01e, 0x002e0019, 0x002e5e00, 0x002e8030, 0x002e9a00, 0x002e9b30, 0x002ef400, 0x002f0030,
+    0x002fd600, 0x002ff019, 0x002ffc00, 0x00300019, 0x00300530, 0x00300619, 0x00300730, 0x00300819,
+    0x00302130, 0x00302a38, 0x00302e31, 0x00303019, 0x00303830, 0x00303c19, 0x00304000, 0x00304136,
+    0x00309700, 0x00309938, 0x00309b19, 0x00309d36, 0x0030a019, 0x0030a13e, 0x0030fb19, 0x0030fd3e,
+    0x00310000, 0x0031050d, 0x00313000, 0x00313131, 0x00318f00, 0x00319019, 0x0031a00d, 0x0031c019,
+    0x0031e400, 0x0031f03e, 0x00320031, 0x00321f00, 0x00322019, 0x00326031, 0x00327f19, 0x0032d03e,
+    0x0032ff19, 0x0033003e, 0x00335819, 0x00340030, 0x004dc019, 0x004e0030, 0x00a000a0, 0x00a48d00,
+    0x00a490a0, 0x00a4c700, 0x00a4d04b, 0x00a5009b, 0x00a62c00, 0x00a6401e, 0x00a6a008, 0x00a6f800,
+    0x00a70019, 0x00a72246, 0x00a78819, 0x00a78b46, 0x00a7cb00, 0x00a7d046, 0x00a7d200, 0x00a7d346,
+    0x00a7d400, 0x00a7d546, 0x00a7da00, 0x00a7f246, 0x00a80088, 0x00a82d00, 0x00a83019, 0x00a83a00,
+    0x00a84078, 0x00a87800, 0x00a8807e, 0x00a8c600, 0x00a8ce7e, 0x00a8da00, 0x00a8e020, 0x00a9003f,
+    0x00a92e19, 0x00a92f3f, 0x00a9307b, 0x00a95400, 0x00a95f7b, 0x00a96031, 0x00a97d00, 0x00a9803b,
+    0x00a9ce00, 0x00a9cf19, 0x00a9d03b, 0x00a9da00, 0x00a9de3b, 0x00a9e05f, 0x00a9ff00, 0x00aa0016,
+    0x00aa3700, 0x00aa4016, 0x00aa4e00, 0x00aa5016, 0x00aa5a00, 0x00aa5c16, 0x00aa605f, 0x00aa808e,
+    0x00aac300, 0x00aadb8e, 0x00aae056, 0x00aaf700, 0x00ab0127, 0x00ab0700, 0x00ab0927, 0x00ab0f00,
+    0x00ab1127, 0x00ab1700, 0x00ab2027, 0x00ab2700, 0x00ab2827, 0x00ab2f00, 0x00ab3046, 0x00ab5b19,
+    0x00ab5c46, 0x00ab652c, 0x00ab6646, 0x00ab6a19, 0x00ab6c00, 0x00ab7017, 0x00abc056, 0x00abee00,
+    0x00abf056, 0x00abfa00, 0x00ac0031, 0x00d7a400, 0x00d7b031, 0x00d7c700, 0x00d7cb31, 0x00d7fc00,
+    0x00f90030, 0x00fa6e00, 0x00fa7030, 0x00fada00, 0x00fb0046, 0x00fb0700, 0x00fb1305, 0x00fb1800,
+    0x00fb1d35, 0x00fb3700, 0x00fb3835, 0x00fb3d00, 0x00fb3e35, 0x00fb3f00, 0x00fb4035, 0x00fb4200,
+    0x00fb4335, 0x00fb4500, 0x00fb4635, 0x00fb5004, 0x00fbc300, 0x00fbd304, 0x00fd3e19, 0x00fd4004,
+    0x00fd9000, 0x00fd9204, 0x00fdc800, 0x00fdcf04, 0x00fdd000, 0x00fdf004, 0x00fe0038, 0x00fe1019,
+    0x00fe1a00, 0x00fe2038, 0x00fe2e1e, 0x00fe3019, 0x00fe5300, 0x00fe5419, 0x00fe6700, 0x00fe6819,
+    0x00fe6c00, 0x00fe7004, 0x00fe7500, 0x00fe7604, 0x00fefd00, 0x00feff19, 0x00ff0000, 0x00ff0119,
+    0x00ff2146, 0x00ff3b19, 0x00ff4146, 0x00ff5b19, 0x00ff663e, 0x00ff7019, 0x00ff713e, 0x00ff9e19,
+    0x00ffa031, 0x00ffbf00, 0x00ffc231, 0x00ffc800, 0x00ffca31, 0x00ffd000, 0x00ffd231, 0x00ffd800,
+    0x00ffda31, 0x00ffdd00, 0x00ffe019, 0x00ffe700, 0x00ffe819, 0x00ffef00, 0x00fff919, 0x00fffe00,
+    0x0100004a, 0x01000c00, 0x01000d4a, 0x01002700, 0x0100284a, 0x01003b00, 0x01003c4a, 0x01003e00,
+    0x01003f4a, 0x01004e00, 0x0100504a, 0x01005e00, 0x0100804a, 0x0100fb00, 0x01010019, 0x01010300,
+    0x01010719, 0x01013400, 0x01013719, 0x0101402c, 0x01018f00, 0x01019019, 0x01019d00, 0x0101a02c,
+    0x0101a100, 0x0101d019, 0x0101fd38, 0x0101fe00, 0x0102804c, 0x01029d00, 0x0102a013, 0x0102d100,
+    0x0102e038, 0x0102e119, 0x0102fc00, 0x0103006a, 0x01032400, 0x01032d6a, 0x0103302a, 0x01034b00,
+    0x0103506c, 0x01037b00, 0x0103809a, 0x01039e00, 0x01039f9a, 0x0103a06d, 0x0103c400, 0x0103c86d,
+    0x0103d600, 0x0104001f, 0x01045080, 0x01048074, 0x01049e00, 0x0104a074, 0x0104aa00, 0x0104b073,
+    0x0104d400, 0x0104d873, 0x0104fc00, 0x01050025, 0x01052800, 0x01053014, 0x01056400, 0x01056f14,
+    0x0105709c, 0x01057b00, 0x01057c9c, 0x01058b00, 0x01058c9c, 0x01059300, 0x0105949c, 0x01059600,
+    0x0105979c, 0x0105a200, 0x0105a39c, 0x0105b200, 0x0105b39c, 0x0105ba00, 0x0105bb9c, 0x0105bd00,
+    0x01060049, 0x01073700, 0x01074049, 0x01075600, 0x01076049, 0x01076800, 0x01078046, 0x01078600,
+    0x01078746, 0x0107b100, 0x0107b246, 0x0107bb00, 0x0108001c, 0x01080600, 0x0108081c, 0x01080900,
+    0x01080a1c, 0x01083600, 0x0108371c, 0x01083900, 0x01083c1c, 0x01083d00, 0x01083f1c, 0x01084037,
+    0x01085600, 0x01085737, 0x01086076, 0x01088060, 0x01089f00, 0x0108a760, 0x0108b000, 0x0108e034,
+    0x0108f300, 0x0108f434, 0x0108f600, 0x0108fb34, 0x01090079, 0x01091c00, 0x01091f79, 0x0109204d,
+    0x01093a00, 0x01093f4d, 0x01094000, 0x01098059, 0x0109a058, 0x0109b800, 0x0109bc58, 0x0109d000,
+    0x0109d258, 0x010a0040, 0x010a0400, 0x010a0540, 0x010a0700, 0x010a0c40, 0x010a1400, 0x010a1540,
+    0x010a1800, 0x010a1940, 0x010a3600, 0x010a3840, 0x010a3b00, 0x010a3f40, 0x010a4900, 0x010a5040,
+    0x010a5900, 0x010a606f, 0x010a806b, 0x010aa000, 0x010ac052, 0x010ae700, 0x010aeb52, 0x010af700,
+    0x010b0006, 0x010b3600, 0x010b3906, 0x010b403a, 0x010b5600, 0x010b583a, 0x010b6039, 0x010b7300,
+    0x010b7839, 0x010b807a, 0x010b9200, 0x010b997a, 0x010b9d00, 0x010ba97a, 0x010bb000, 0x010c0070,
+    0x010c4900, 0x010c8069, 0x010cb300, 0x010cc069, 0x010cf300, 0x010cfa69, 0x010d0032, 0x010d2800,
+    0x010d3032, 0x010d3a00, 0x010e6004, 0x010e7f00, 0x010e809f, 0x010eaa00, 0x010eab9f, 0x010eae00,
+    0x010eb09f, 0x010eb200, 0x010f006e, 0x010f2800, 0x010f3084, 0x010f5a00, 0x010f7071, 0x010f8a00,
+    0x010fb018, 0x010fcc00, 0x010fe026, 0x010ff700, 0x0110000e, 0x01104e00, 0x0110520e, 0x01107600,
+    0x01107f0e, 0x0110803c, 0x0110c300, 0x0110cd3c, 0x0110ce00, 0x0110d085, 0x0110e900, 0x0110f085,
+    0x0110fa00, 0x01110015, 0x01113500, 0x01113615, 0x01114800, 0x0111504e, 0x01117700, 0x0111807f,
+    0x0111e000, 0x0111e183, 0x0111f500, 0x01120043, 0x01121200, 0x01121343, 0x01123f00, 0x0112805e,
+    0x01128700, 0x0112885e, 0x01128900, 0x01128a5e, 0x01128e00, 0x01128f5e, 0x01129e00, 0x01129f5e,
+    0x0112aa00, 0x0112b044, 0x0112eb00, 0x0112f044, 0x0112fa00, 0x0113002b, 0x01130400, 0x0113052b,
+    0x01130d00, 0x01130f2b, 0x01131100, 0x0113132b, 0x01132900, 0x01132a2b, 0x01133100, 0x0113322b,
+    0x01133400, 0x0113352b, 0x01133a00, 0x01133b38, 0x01133c2b, 0x01134500, 0x0113472b, 0x01134900,
+    0x01134b2b, 0x01134e00, 0x0113502b, 0x01135100, 0x0113572b, 0x01135800, 0x01135d2b, 0x01136400,
+    0x0113662b, 0x01136d00, 0x0113702b, 0x01137500, 0x01140063, 0x01145c00, 0x01145d63, 0x01146200,
+    0x01148098, 0x0114c800, 0x0114d098, 0x0114da00, 0x01158081, 0x0115b600, 0x0115b881, 0x0115de00,
+    0x0116005b, 0x01164500, 0x0116505b, 0x01165a00, 0x0116605c, 0x01166d00, 0x0116808f, 0x0116ba00,
+    0x0116c08f, 0x0116ca00, 0x01170002, 0x01171b00, 0x01171d02, 0x01172c00, 0x01173002, 0x01174700,
+    0x01180022, 0x01183c00, 0x0118a09e, 0x0118f300, 0x0118ff9e, 0x01190021, 0x01190700, 0x01190921,
+    0x01190a00, 0x01190c21, 0x01191400, 0x01191521, 0x01191700, 0x01191821, 0x01193600, 0x01193721,
+    0x01193900, 0x01193b21, 0x01194700, 0x01195021, 0x01195a00, 0x0119a061, 0x0119a800, 0x0119aa61,
+    0x0119d800, 0x0119da61, 0x0119e500, 0x011a00a1, 0x011a4800, 0x011a5086, 0x011aa300, 0x011ab012,
+    0x011ac077, 0x011af900, 0x011c000c, 0x011c0900, 0x011c0a0c, 0x011c3700, 0x011c380c, 0x011c4600,
+    0x011c500c, 0x011c6d00, 0x011c7053, 0x011c9000, 0x011c9253, 0x011ca800, 0x011ca953, 0x011cb700,
+    0x011d0054, 0x011d0700, 0x011d0854, 0x011d0a00, 0x011d0b54, 0x011d3700, 0x011d3a54, 0x011d3b00,
+    0x011d3c54, 0x011d3e00, 0x011d3f54, 0x011d4800, 0x011d5054, 0x011d5a00, 0x011d602e, 0x011d6600,
+    0x011d672e, 0x011d6900, 0x011d6a2e, 0x011d8f00, 0x011d902e, 0x011d9200, 0x011d932e, 0x011d9900,
+    0x011da02e, 0x011daa00, 0x011ee04f, 0x011ef900, 0x011fb04b, 0x011fb100, 0x011fc090, 0x011ff200,
+    0x011fff90, 0x0120001b, 0x01239a00, 0x0124001b, 0x01246f00, 0x0124701b, 0x01247500, 0x0124801b,
+    0x01254400, 0x012f901d, 0x012ff300, 0x01300024, 0x01342f00, 0x01343024, 0x01343900, 0x01440003,
+    0x01464700, 0x01680008, 0x016a3900, 0x016a405d, 0x016a5f00, 0x016a605d, 0x016a6a00, 0x016a6e5d,
+    0x016a7091, 0x016abf00, 0x016ac091, 0x016aca00, 0x016ad009, 0x016aee00, 0x016af009, 0x016af600,
+    0x016b0075, 0x016b4600, 0x016b5075, 0x016b5a00, 0x016b5b75, 0x016b6200, 0x016b6375, 0x016b7800,
+    0x016b7d75, 0x016b9000, 0x016e4055, 0x016e9b00, 0x016f005a, 0x016f4b00, 0x016f4f5a, 0x016f8800,
+    0x016f8f5a, 0x016fa000, 0x016fe092, 0x016fe165, 0x016fe230, 0x016fe441, 0x016fe500, 0x016ff030,
+    0x016ff200, 0x01700092, 0x0187f800, 0x01880092, 0x018b0041, 0x018cd600, 0x018d0092, 0x018d0900,
+    0x01aff03e, 0x01aff400, 0x01aff53e, 0x01affc00, 0x01affd3e, 0x01afff00, 0x01b0003e, 0x01b00136,
+    0x01b1203e, 0x01b12300, 0x01b15036, 0x01b15300, 0x01b1643e, 0x01b16800, 0x01b17065, 0x01b2fc00,
+    0x01bc0023, 0x01bc6b00, 0x01bc7023, 0x01bc7d00, 0x01bc8023, 0x01bc8900, 0x01bc9023, 0x01bc9a00,
+    0x01bc9c23, 0x01bca019, 0x01bca400, 0x01cf0038, 0x01cf2e00, 0x01cf3038, 0x01cf4700, 0x01cf5019,
+    0x01cfc400, 0x01d00019, 0x01d0f600, 0x01d10019, 0x01d12700, 0x01d12919, 0x01d16738, 0x01d16a19,
+    0x01d17b38, 0x01d18319, 0x01d18538, 0x01d18c19, 0x01d1aa38, 0x01d1ae19, 0x01d1eb00, 0x01d2002c,
+    0x01d24600, 0x01d2e019, 0x01d2f400, 0x01d30019, 0x01d35700, 0x01d36019, 0x01d37900, 0x01d40019,
+    0x01d45500, 0x01d45619, 0x01d49d00, 0x01d49e19, 0x01d4a000, 0x01d4a219, 0x01d4a300, 0x01d4a519,
+    0x01d4a700, 0x01d4a919, 0x01d4ad00, 0x01d4ae19, 0x01d4ba00, 0x01d4bb19, 0x01d4bc00, 0x01d4bd19,
+    0x01d4c400, 0x01d4c519, 0x01d50600, 0x01d50719, 0x01d50b00, 0x01d50d19, 0x01d51500, 0x01d51619,
+    0x01d51d00, 0x01d51e19, 0x01d53a00, 0x01d53b19, 0x01d53f00, 0x01d54019, 0x01d54500, 0x01d54619,
+    0x01d54700, 0x01d54a19, 0x01d55100, 0x01d55219, 0x01d6a600, 0x01d6a819, 0x01d7cc00, 0x01d7ce19,
+    0x01d80082, 0x01da8c00, 0x01da9b82, 0x01daa000, 0x01daa182, 0x01dab000, 0x01df0046, 0x01df1f00,
+    0x01e00029, 0x01e00700, 0x01e00829, 0x01e01900, 0x01e01b29, 0x01e02200, 0x01e02329, 0x01e02500,
+    0x01e02629, 0x01e02b00, 0x01e10066, 0x01e12d00, 0x01e13066, 0x01e13e00, 0x01e14066, 0x01e14a00,
+    0x01e14e66, 0x01e15000, 0x01e29099, 0x01e2af00, 0x01e2c09d, 0x01e2fa00, 0x01e2ff9d, 0x01e30000,
+    0x01e7e027, 0x01e7e700, 0x01e7e827, 0x01e7ec00, 0x01e7ed27, 0x01e7ef00, 0x01e7f027, 0x01e7ff00,
+    0x01e80057, 0x01e8c500, 0x01e8c757, 0x01e8d700, 0x01e90001, 0x01e94c00, 0x01e95001, 0x01e95a00,
+    0x01e95e01, 0x01e96000, 0x01ec7119, 0x01ecb500, 0x01ed0119, 0x01ed3e00, 0x01ee0004, 0x01ee0400,
+    0x01ee0504, 0x01ee2000, 0x01ee2104, 0x01ee2300, 0x01ee2404, 0x01ee2500, 0x01ee2704, 0x01ee2800,
+    0x01ee2904, 0x01ee3300, 0x01ee3404, 0x01ee3800, 0x01ee3904, 0x01ee3a00, 0x01ee3b04, 0x01ee3c00,
+    0x01ee4204, 0x01ee4300, 0x01ee4704, 0x01ee4800, 0x01ee4904, 0x01ee4a00, 0x01ee4b04, 0x01ee4c00,
+    0x01ee4d04, 0x01ee5000, 0x01ee5104, 0x01ee5300, 0x01ee5404, 0x01ee5500, 0x01ee5704, 0x01ee5800,
+    0x01ee5904, 0x01ee5a00, 0x01ee5b04, 0x01ee5c00, 0x01ee5d04, 0x01ee5e00, 0x01ee5f04, 0x01ee6000,
+    0x01ee6104, 0x01ee6300, 0x01ee6404, 0x01ee6500, 0x01ee6704, 0x01ee6b00, 0x01ee6c04, 0x01ee7300,
+    0x01ee7404, 0x01ee7800, 0x01ee7904, 0x01ee7d00, 0x01ee7e04, 0x01ee7f00, 0x01ee8004, 0x01ee8a00,
+    0x01ee8b04, 0x01ee9c00, 0x01eea104, 0x01eea400, 0x01eea504, 0x01eeaa00, 0x01eeab04, 0x01eebc00,
+    0x01eef004, 0x01eef200, 0x01f00019, 0x01f02c00, 0x01f03019, 0x01f09400, 0x01f0a019, 0x01f0af00,
+    0x01f0b119, 0x01f0c000, 0x01f0c119, 0x01f0d000, 0x01f0d119, 0x01f0f600, 0x01f10019, 0x01f1ae00,
+    0x01f1e619, 0x01f20036, 0x01f20119, 0x01f20300, 0x01f21019, 0x01f23c00, 0x01f24019, 0x01f24900,
+    0x01f25019, 0x01f25200, 0x01f26019, 0x01f26600, 0x01f30019, 0x01f6d800, 0x01f6dd19, 0x01f6ed00,
+    0x01f6f019, 0x01f6fd00, 0x01f70019, 0x01f77400, 0x01f78019, 0x01f7d900, 0x01f7e019, 0x01f7ec00,
+    0x01f7f019, 0x01f7f100, 0x01f80019, 0x01f80c00, 0x01f81019, 0x01f84800, 0x01f85019, 0x01f85a00,
+    0x01f86019, 0x01f88800, 0x01f89019, 0x01f8ae00, 0x01f8b019, 0x01f8b200, 0x01f90019, 0x01fa5400,
+    0x01fa6019, 0x01fa6e00, 0x01fa7019, 0x01fa7500, 0x01fa7819, 0x01fa7d00, 0x01fa8019, 0x01fa8700,
+    0x01fa9019, 0x01faad00, 0x01fab019, 0x01fabb00, 0x01fac019, 0x01fac600, 0x01fad019, 0x01fada00,
+    0x01fae019, 0x01fae800, 0x01faf019, 0x01faf700, 0x01fb0019, 0x01fb9300, 0x01fb9419, 0x01fbcb00,
+    0x01fbf019, 0x01fbfa00, 0x02000030, 0x02a6e000, 0x02a70030, 0x02b73900, 0x02b74030, 0x02b81e00,
+    0x02b82030, 0x02cea200, 0x02ceb030, 0x02ebe100, 0x02f80030, 0x02fa1e00, 0x03000030, 0x03134b00,
+    0x0e000119, 0x0e000200, 0x0e002019, 0x0e008000, 0x0e010038, 0x0e01f000,
+};
+
+static std::string looseName(const std::u32string &name)
+{
+    std::string result;
+
+    for (char32_t ch : name)
+    {
+        if (ch == U' ' || ch == U'-' || ch == U'_')
+            continue;
+
+        /* property names are all ASCII, anything else keeps the name from matching */
+        if (ch >= 0x80)
+            result += '\x80';
+        else
+            result += static_cast<char>(ch >= U'A' && ch <= U'Z' ? ch + 0x20 : ch);
+    }
+
+    return result;
+}
+
+static std::string looseName(const char *name)
+{
+    std::u32string wide;
+
+    while (*name)
+        wide += static_cast<char32_t>(*name++);
+
+    return looseName(wide);
+}
+
+/* appends runs whose value is selected by `select`, merging adjacent ones */
+template <typename Select>
+static void runsOf(const uint32_t *runs, size_t count, Select &&select, std::vector<std::pair<char32_t, char32_t>> &ranges)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        if (!select(runs[i] & 0xff))
+            continue;
+
+        char32_t lower = runs[i] >> 8;
+        char32_t upper = i + 1 < count ? (runs[i + 1] >> 8) - 1 : 0x10ffff;
+
+        if (!ranges.empty() && ranges.back().second + 1 == lower)
+            ranges.back().second = upper;
+        else
+            ranges.emplace_back(lower, upper);
+    }
+}
+
+namespace FastRegExp
+{
+namespace Unicode
+{
+char32_t simpleFold(char32_t ch)
+{
+    const CaseRange *end = CaseRanges + sizeof(CaseRanges) / sizeof(CaseRanges[0]);
+    const CaseRange *iter = std::upper_bound(CaseRanges, end, ch, [](char32_t x, const CaseRange &y){ return x < y.lower; });
+
+    if (iter == CaseRanges || (--iter)->upper < ch)
+        return ch;
+
+    if (iter->delta != Alternate)
+        return ch + iter->delta;
+    else
+        return ((ch - iter->lower) & 1) ? ch - 1 : ch + 1;
+}
+
+void foldRanges(std::vector<std::pair<char32_t, char32_t>> &ranges)
+{
+    size_t count = ranges.size();
+    const CaseRange *end = CaseRanges + sizeof(CaseRanges) / sizeof(CaseRanges[0]);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        char32_t lower = ranges[i].first;
+        char32_t upper = ranges[i].second;
+        const CaseRange *iter = std::upper_bound(CaseRanges, end, lower, [](char32_t x, const CaseRange &y){ return x < y.lower; });
+
+        if (iter != CaseRanges && (iter - 1)->upper >= lower)
+            iter--;
+
+        /* walk the orbits of every cased character within the range */
+        for (; iter != end && iter->lower <= upper; iter++)
+        {
+            char32_t first = std::max(lower, iter->lower);
+            char32_t last = std::min(upper, iter->upper);
+
+            for (char32_t ch = first; ch <= last; ch++)
+                for (char32_t next = simpleFold(ch); next != ch; next = simpleFold(next))
+                    ranges.emplace_back(next, next);
+        }
+    }
+}
+bool propertyRanges(const std::u32string &name, std::vector<std::pair<char32_t, char32_t>> &ranges)
+{
+    std::string kind;
+    std::string value = looseName(name);
+    size_t split = name.find_first_of(U"=:");
+
+    if (split != std::u32string::npos)
+    {
+        kind = looseName(name.substr(0, split));
+        value = looseName(name.substr(split + 1));
+
+        if (kind != "gc" && kind != "generalcategory" && kind != "sc" && kind != "script")
+            return false;
+    }
+
+    if (kind.empty() || kind[0] == 'g')
+    {
+        for (const CategoryName &category : CategoryNames)
+        {
+            if (looseName(category.name) == value)
+            {
+                uint32_t mask = category.categories;
+                runsOf(CategoryRuns, sizeof(CategoryRuns) / sizeof(CategoryRuns[0]), [&](uint32_t x){ return (mask >> x) & 1; }, ranges);
+                return true;
+            }
+        }
+    }
+
+    if (kind.empty() || kind[0] == 's')
+    {
+        for (uint32_t i = 0; i < sizeof(ScriptNames) / sizeof(ScriptNames[0]); i++)
+        {
+            if (looseName(ScriptNames[i]) == value)
+            {
+                runsOf(ScriptRuns, sizeof(ScriptRuns) / sizeof(ScriptRuns[0]), [&](uint32_t x){ return x == i; }, ranges);
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+}
+}
@@ -0,0 +1,476 @@
+#include <random>
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdio>
+#include <cstdint>
+
+#include "CPU.h"
+#include "DFA.h"
+#include "RegExp.h"
+#include "Scanner.h"
+#include "DenseDFA.h"
+#include "RegExpSet.h"
+#include "Fragments.h"
+#include "Backtracker.h"
+#include "SyntaxError.h"
+
+#if __cplusplus >= 202002L
+#include "StaticRegExp.h"
+#endif
+
+using namespace FastRegExp;
+
+/* every check compares an engine against a simpler one, or against the answer of a case that once went wrong */
+static size_t failures = 0;
+
+static void check(bool isPassed, const char *name, const std::string &detail)
+{
+    if (isPassed)
+        return;
+
+    /* only the first few of each run, one broken engine fails thousands of checks */
+    if (failures++ < 20)
+        fprintf(stderr, "FAIL %s: %s\n", name, detail.c_str());
+}
+
+/* `count` characters picked from `alphabet`, which may hold multi-byte ones */
+static std::string generate(std::mt19937 &rng, const std::vector<std::string> &alphabet, size_t count)
+{
+    std::string str;
+
+    for (size_t i = 0; i < count; i++)
+        str += alphabet[rng() % alphabet.size()];
+
+    return str;
+}
+
+static void testEngines(void)
+{
+    static const char *patterns[] = {
+        "abc", "a|b|cd", "a*b+c?", "[a-c]{2,4}x", "(?:ab|ba)*$", "^a.*b$", "\\bab\\b", "\\B", "\\b", "", "x*",
+        "é+", "[^a]", ".", "[à-ü]\\B", "(?:é|a)\\b", "[^\"]*\"", "\"[^\"]*\"", ".*?\\n", "(?s).*?é", "^[^\\n]*$",
+        "(?m)^b", "(?m)a$", "[0-9]{3}", "(a|b)c*\\1", "a(?=b)", "(?<!a)b", "(a+)+c",
+    };
+
+    static const std::vector<std::string> alphabet = { "a", "b", "c", "x", "0", " ", "\n", "\"", "\xc3\xa9", "\xe2\x82\xac" };
+
+    std::mt19937 rng(1);
+
+    for (const char *pattern : patterns)
+    {
+        RegExp regexp(pattern);
+        DenseDFA dense;
+        bool isDFA = DFA::isSupported(regexp.program());
+        bool isDense = isDFA && dense.build(regexp.program());
+
+        for (size_t i = 0; i < 200; i++)
+        {
+            std::string str = generate(rng, alphabet, rng() % 10);
+
+            for (size_t start = 0; start <= str.size(); start++)
+            {
+                Backtracker backtracker(regexp.program());
+                bool isMatched = backtracker.exec(str.data(), str.size(), start);
+                std::string detail = std::string(pattern) + " on \"" + str + "\" from " + std::to_string(start);
+
+                /* no capture, and so no match, may begin or end inside a character */
+                if (isMatched)
+                    for (ssize_t slot : backtracker.slots())
+                        check(slot <= 0 || static_cast<size_t>(slot) >= str.size() || !Backtracker::isContinuation(str[slot]), "boundary", detail);
+
+                if (isDFA)
+                {
+                    DFA dfa(regexp.program());
+                    check(dfa.exec(str.data(), str.size(), start) == isMatched, "dfa", detail);
+                }
+
+                if (isDense)
+                    check(dense.exec(str.data(), str.size(), start) == isMatched, "dense", detail);
+            }
+        }
+    }
+}
+
+static void testParallel(void)
+{
+    /* anchored periodic patterns make the walks of a chunk meet in some intervals only */
+    static const char *patterns[] = {
+        "^(?:..)*$", "^(?:...)*$", "^(?:.....)*$", "^(?:[ab]{3})*$", "(?:ab|ba){4}", "^[^\\n]*\\n(?:..)*$", "\\bbab\\b", "x",
+    };
+
+    std::mt19937 rng(3);
+
+    for (const char *pattern : patterns)
+    {
+        RegExp regexp(pattern);
+        DenseDFA dense;
+
+        if (!dense.build(regexp.program()))
+        {
+            check(false, "parallel", std::string(pattern) + " not built");
+            continue;
+        }
+
+        for (size_t i = 0; i < 3; i++)
+        {
+            std::string str(6 * DenseDFA::MinChunk + rng() % 16, 'a');
+
+            for (char &ch : str)
+                ch = "ab \n"[rng() % (i ? 4 : 2)];
+
+            for (size_t threads : { 2, 3, 5 })
+            {
+                for (size_t start : { 0, 1, 7 })
+                {
+                    bool isMatched = dense.exec(str.data(), str.size(), start);
+                    bool isParallel = dense.execParallel(str.data(), str.size(), start, threads);
+                    std::string detail = std::string(pattern) + " on " + std::to_string(threads) + " threads from " + std::to_string(start);
+
+                    check(isMatched == isParallel, "parallel", detail);
+                }
+            }
+        }
+    }
+}
+
+static void testScanner(void)
+{
+    std::vector<ByteSet> sets(6);
+    std::mt19937 rng(5);
+
+    /* every shape of kernel: all bytes, a range, a few excluded ones, and arbitrary sets */
+    sets[0].addRange(0, 255);
+    sets[1].addRange('a', 'z');
+
+    for (unsigned int ch = 0; ch < 256; ch++)
+        if (ch != '"')
+            sets[2].add(static_cast<uint8_t>(ch));
+
+    for (unsigned int ch = 0; ch < 256; ch++)
+        if (ch != '"' && ch != '\\' && ch != '\n')
+            sets[3].add(static_cast<uint8_t>(ch));
+
+    sets[4].addRange('a', 'z');
+    sets[4].addRange('A', 'Z');
+    sets[4].addRange('0', '9');
+    sets[4].add('_');
+
+    for (unsigned int ch = 0; ch < 256; ch++)
+        if (rng() % 8)
+            sets[5].add(static_cast<uint8_t>(ch));
+
+    CPU::Tier highest = CPU::tier();
+    std::vector<uint8_t> data(512);
+
+    for (int tier = static_cast<int>(CPU::Tier::TierScalar); tier <= static_cast<int>(highest); tier++)
+    {
+        CPU::limit(static_cast<CPU::Tier>(tier));
+
+        for (size_t i = 0; i < sets.size(); i++)
+        {
+            Scanner scanner(sets[i]);
+
+            for (size_t round = 0; round < 2000; round++)
+            {
+                /* mostly bytes of the set, with the first one outside of it anywhere in or past the input */
+                size_t offset = rng() % 64;
+                size_t len = rng() % (data.size() - offset);
+                size_t expect = 0;
+
+                for (size_t j = 0; j < data.size(); j++)
+                    data[j] = static_cast<uint8_t>(rng() % 4 ? "az_\"\\\n\xc3\xa9"[rng() % 8] : rng());
+
+                while (expect < len && sets[i].test(data[offset + expect]))
+                    expect++;
+
+                check(scanner.span(data.data() + offset, len) == expect, "scanner",
+                      std::string(CPU::nameOf(static_cast<CPU::Tier>(tier))) + " set " + std::to_string(i) + " at " + std::to_string(offset));
+            }
+        }
+    }
+
+    CPU::limit(CPU::Tier::TierAVX512);
+}
+
+static void testSet(void)
+{
+    static const char *atoms[] = {
+        "a", "b", "c", "\\w", "[ab]+", "(x|yz)", "\\d{2}", "(?=a)", "\\bb", "(a)\\1", "c{9,}", "^a", "b$", "é", "(?<!c)a", "[^a]*",
+    };
+
+    static const std::vector<std::string> alphabet = { "a", "b", "c", "x", "y", "z", "1", "2", " ", "\xc3\xa9" };
+
+    std::mt19937 rng(7);
+    RegExpSet set(4);
+    std::vector<size_t> ids;
+    std::vector<std::unique_ptr<RegExp>> patterns;
+
+    for (size_t round = 0; round < 100; round++)
+    {
+        std::vector<std::string> added(1 + rng() % 4);
+
+        for (std::string &pattern : added)
+            for (size_t i = rng() % 3; i < 3; i++)
+                pattern += atoms[rng() % (sizeof(atoms) / sizeof(atoms[0]))];
+
+        for (size_t id : set.add(added))
+            ids.push_back(id);
+
+        for (const std::string &pattern : added)
+            patterns.emplace_back(new RegExp(pattern));
+
+        /* removed patterns stay in the reference as null */
+        if (rng() % 3 == 0)
+        {
+            size_t index = rng() % ids.size();
+
+            set.remove(ids[index]);
+            patterns[index].reset();
+        }
+
+        for (size_t i = 0; i < 8; i++)
+        {
+            std::string str = generate(rng, alphabet, rng() % 12);
+            std::vector<size_t> expect;
+            std::vector<size_t> matched;
+
+            for (size_t j = 0; j < patterns.size(); j++)
+                if (patterns[j] && patterns[j]->test(str))
+                    expect.push_back(ids[j]);
+
+            set.match(str, matched);
+            check(matched == expect, "set", "\"" + str + "\" after round " + std::to_string(round));
+            check(set.test(str) == !expect.empty(), "set", "test \"" + str + "\"");
+        }
+    }
+}
+
+static void testBatch(void)
+{
+    static const char *patterns[] = { "^[a-z0-9._%+-]+@[a-z0-9.-]+\\.[a-z]{2,}$", "[0-9a-f]{8}-[0-9a-f]{4}", "\\bx\\b", "^$", "a*$", "(a)\\1" };
+    static const std::vector<std::string> alphabet = { "a", "b", "0", "9", ".", "-", "@", "x", " ", "f" };
+
+    std::mt19937 rng(9);
+    std::vector<std::string> strs;
+
+    for (size_t i = 0; i < 500; i++)
+        strs.push_back(generate(rng, alphabet, rng() % 30));
+
+    for (const char *pattern : patterns)
+    {
+        RegExp regexp(pattern);
+        std::vector<uint64_t> out((strs.size() + 63) / 64);
+
+        regexp.matchBatch(strs.data(), strs.size(), out.data());
+
+        for (size_t i = 0; i < strs.size(); i++)
+            check(((out[i / 64] >> (i % 64)) & 1) == regexp.test(strs[i]), "batch", std::string(pattern) + " on \"" + strs[i] + "\"");
+    }
+}
+
+/* match offsets of `findIter`, without the groups */
+static std::vector<std::pair<ssize_t, ssize_t>> matches(const char *pattern, const std::string &str)
+{
+    RegExp regexp(pattern);
+    std::vector<Span> spans;
+    std::vector<std::pair<ssize_t, ssize_t>> result;
+
+    regexp.findIter(str, spans);
+
+    for (size_t i = 0; i < spans.size(); i += regexp.groups() + 1)
+        result.emplace_back(spans[i].begin, spans[i].end);
+
+    return result;
+}
+
+static void testRegressions(void)
+{
+    typedef std::vector<std::pair<ssize_t, ssize_t>> Matches;
+
+    /* `\B` holds between the bytes of "é", but no match may start there */
+    check(matches("\\B", "a\xc3\xa9") == Matches({ { 3, 3 } }), "regression", "\\B inside a character");
+    check(matches("", "\xc3\xa9x") == Matches({ { 0, 0 }, { 2, 2 }, { 3, 3 } }), "regression", "empty matches inside a character");
+
+    /* after an empty match a non-empty one is still tried at the same position */
+    check(matches("\\b|a", "a") == Matches({ { 0, 0 }, { 0, 1 }, { 1, 1 } }), "regression", "\\b|a after an empty match");
+    check(matches("x*", "axb") == Matches({ { 0, 0 }, { 1, 2 }, { 2, 2 }, { 3, 3 } }), "regression", "x* after an empty match");
+
+    /* loops nested in counted repeats split the input as many ways as their unrolled sequence, so they are either
+     * memoized or refused as risky */
+    for (const char *pattern : { "(?:a+){9}b", "(?:a+){20}b", "(?:a?){30}a{30}" })
+    {
+        bool isRejected = false;
+        RegExp regexp(pattern);
+
+        try
+        {
+            RegExp(pattern, AST::Flags::FlagRejectRisky);
+        }
+        catch (const SyntaxError &)
+        {
+            isRejected = true;
+        }
+
+        check(regexp.analysis().riskPos >= 0, "regression", std::string(pattern) + " not found risky");
+        check(regexp.analysis().isRisky() == isRejected, "regression", std::string(pattern) + " rejected only if not memoized");
+    }
+
+    /* bounds above `Compiler::MaxUnroll` are still unrolled for small bodies, so they keep the DFA and memoization */
+    for (const char *pattern : { "(|a|b){9,}x", "(?:ab|a){20}c", "(?:a+){20}b", "(?:a?){30}a{30}" })
+    {
+        Budget budget;
+        RegExp regexp(pattern);
+        std::vector<ssize_t> slots;
+        std::string str(30, 'a');
+
+        budget.steps = 100000;
+        check(DFA::isSupported(regexp.program()), "regression", std::string(pattern) + " not supported by the DFA");
+        check(regexp.search(str + "b", slots, budget) != Budget::Result::ResultExceeded, "regression", std::string(pattern) + " exceeded it's budget");
+    }
+
+    /* anchored programs stop at the dead state, also once the transitions into it are cached */
+    {
+        bool result;
+        Budget budget;
+        RegExp regexp("^ab");
+        DFA dfa(regexp.program(), &budget);
+        std::string str(1 << 20, 'x');
+        const char *strs[] = { str.data() };
+        size_t lens[] = { str.size() };
+
+        dfa.execBatch(strs, lens, 1, &result);
+        check(!result && !dfa.exec(str.data(), str.size(), 0), "regression", "^ab on a long input");
+        check(budget.stepsUsed() <= Budget::Block, "regression", "^ab scanned past the dead state");
+    }
+
+    /* group numbers past the last group are refused at the reference, however many digits they have */
+    for (const char *format : { "x$3", "x${3}", "x${99999999999999999999}", "x$123456789012345678901234567890" })
+    {
+        size_t pos = SIZE_MAX;
+        RegExp regexp("(a)(b)");
+
+        try
+        {
+            regexp.substitution(format);
+        }
+        catch (const SyntaxError &error)
+        {
+            pos = error.pos();
+        }
+
+        check(pos == 1, "regression", std::string(format) + " not refused at the reference");
+    }
+
+    {
+        std::string out;
+        RegExp regexp("(a)(b)");
+
+        regexp.replace("ab", regexp.substitution("$2${1}$02"), out);
+        check(out == "bab", "regression", "valid group references");
+    }
+
+    /* unbounded classes taking any non-ASCII character run as whole-character byte loops */
+    for (const char *pattern : { "[^\"]*", ".*?\\n" })
+    {
+        bool isWhole = false;
+        RegExp regexp(pattern);
+
+        for (const Instruction &ins : regexp.program().code)
+            isWhole |= ins.opcode == Instruction::Opcode::OpcodeRepeatSet && ins.isWhole;
+
+        check(isWhole, "regression", std::string(pattern) + " not lowered to a whole-character loop");
+    }
+
+    /* the least recently used fragment goes first */
+    Fragments fragments(3);
+    std::shared_ptr<const Fragments::Fragment> fragment = std::make_shared<Fragments::Fragment>();
+
+    fragments.insert("a", fragment);
+    fragments.insert("b", fragment);
+    fragments.insert("c", fragment);
+    fragments.find("a");
+    fragments.insert("d", fragment);
+
+    check(fragments.find("a") && !fragments.find("b") && fragments.find("c") && fragments.find("d"), "regression", "fragment eviction order");
+    check(fragments.size() == 3, "regression", "fragment limit");
+}
+
+#if __cplusplus >= 202002L
+/* compile time patterns against the runtime engine, on every string of "a" and "b" up to 8 characters */
+template <Static::Pattern P>
+static void testStatic(const char *pattern)
+{
+    RegExp regexp(pattern);
+
+    for (size_t len = 0; len <= 8; len++)
+    {
+        for (size_t bits = 0; bits < (1u << len); bits++)
+        {
+            std::string str;
+            std::vector<ssize_t> slots;
+            typename StaticRegExp<P>::Groups groups;
+
+            for (size_t i = 0; i < len; i++)
+                str += "ab"[(bits >> i) & 1];
+
+            bool isMatched = StaticRegExp<P>::match(str, groups);
+            std::string detail = std::string(pattern) + " on \"" + str + "\"";
+
+            check(isMatched == regexp.fullMatch(str, slots), "static", detail);
+
+            if (isMatched)
+                for (size_t i = 0; i < groups.size(); i++)
+                    check(groups[i].data() ? groups[i].data() - str.data() == slots[i * 2] && groups[i].data() + groups[i].size() - str.data() == slots[i * 2 + 1] : slots[i * 2] < 0, "static", detail + " group " + std::to_string(i));
+        }
+    }
+}
+
+static void testStatics(void)
+{
+    testStatic<"(?:a|ab)*b">("(?:a|ab)*b");
+    testStatic<"(a|ab)+?(b*)">("(a|ab)+?(b*)");
+    testStatic<"(?:(a)|b)*">("(?:(a)|b)*");
+    testStatic<"((a*)b){1,3}a?">("((a*)b){1,3}a?");
+    testStatic<"(?:(ab)|(a|))*?b*">("(?:(ab)|(a|))*?b*");
+
+    /* characters are matched as a whole, as by the runtime engine */
+    StaticRegExp<"\\B">::Groups border;
+
+    check(StaticRegExp<"^.$">::match("\xc3\xa9") && RegExp("^.$").test("\xc3\xa9"), "static", "'.' on a 2 byte character");
+    check(StaticRegExp<"[^a]{2}">::match("\xe2\x82\xac\xf0\x9f\x98\x80"), "static", "[^a]{2} on 3 and 4 byte characters");
+    check(StaticRegExp<"\xc3\xa9+">::match("\xc3\xa9\xc3\xa9"), "static", "repeated non-ASCII literal");
+    check(StaticRegExp<"\\xe9{2}">::match("\xc3\xa9\xc3\xa9"), "static", "\\xe9 as a code point");
+    check(StaticRegExp<"(.*?)(\\W+)">::match("a\xc3\xa9"), "static", "lazy and greedy loops over characters");
+    check(!StaticRegExp<".">::match("\xc3") && !StaticRegExp<".">::match("\xed\xa0\x80"), "static", "malformed characters");
+    check(StaticRegExp<"\\B">::search("a\xc3\xa9", border) && border[0].data() == std::string_view("a\xc3\xa9").data() + 3, "static", "\\B inside a character");
+
+    /* iterations of a repeat don't nest, so long inputs can't overflow the stack */
+    std::string str;
+
+    for (size_t i = 0; i < 1000000; i++)
+        str += "ab";
+
+    check(StaticRegExp<"(?:ab)*">::match(str), "static", "(?:ab)* on 2 MB");
+    check(StaticRegExp<"(a|ab)*?">::match(str), "static", "(a|ab)*? on 2 MB");
+}
+#endif
+
+int main(void)
+{
+    testEngines();
+    testParallel();
+    testScanner();
+    testSet();
+    testBatch();
+    testRegressions();
+
+#if __cplusplus >= 202002L
+    testStatics();
+#endif
+
+    if (failures)
+        fprintf(stderr, "%zu checks failed\n", failures);
+
+    return failures ? 1 : 0;
+}
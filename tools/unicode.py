@@ -0,0 +1,192 @@
+#!/usr/bin/env python3
+"""Generates the Unicode tables of src/Unicode.cpp from the Unicode character database.
+
+    usage: tools/unicode.py <ucd directory> [src/Unicode.cpp]
+
+The directory must hold these files of the wanted version (https://www.unicode.org/Public/<version>/ucd/):
+
+    UnicodeData.txt     general categories of `CategoryRuns`
+    Scripts.txt         scripts of `ScriptNames` and `ScriptRuns`
+    CaseFolding.txt     simple case folding orbits of `CaseRanges`
+
+The tables are replaced in place, everything else in the file is kept as it is.
+"""
+
+import os
+import re
+import sys
+
+MAX_CODE_POINT = 0x10ffff
+
+# general categories, numbered as in the `Category` enum
+CATEGORIES = [
+    'Lu', 'Ll', 'Lt', 'Lm', 'Lo', 'Mn', 'Mc', 'Me', 'Nd', 'Nl', 'No', 'Pc', 'Pd', 'Ps', 'Pe',
+    'Pi', 'Pf', 'Po', 'Sm', 'Sc', 'Sk', 'So', 'Zs', 'Zl', 'Zp', 'Cc', 'Cf', 'Cs', 'Co', 'Cn',
+]
+
+# upper and lower case letters alternate within the range, as `Alternate` in src/Unicode.cpp
+ALTERNATE = None
+
+
+def records(path):
+    """yields the fields of every data line, without comments"""
+    with open(path, encoding='utf-8') as file:
+        for line in file:
+            line = line.split('#', 1)[0].strip()
+
+            if line:
+                yield [field.strip() for field in line.split(';')]
+
+
+def code_points(field):
+    """first and last code point of a `XXXX` or `XXXX..YYYY` field"""
+    lower, _, upper = field.partition('..')
+    return int(lower, 16), int(upper or lower, 16)
+
+
+def categories(ucd):
+    """general category of every code point, unlisted ones are unassigned"""
+    values = [CATEGORIES.index('Cn')] * (MAX_CODE_POINT + 1)
+    first = None
+
+    for fields in records(os.path.join(ucd, 'UnicodeData.txt')):
+        code = int(fields[0], 16)
+        value = CATEGORIES.index(fields[2])
+
+        # large blocks are given by their first and last code point only
+        if fields[1].endswith(', First>'):
+            first = code
+            continue
+
+        if fields[1].endswith(', Last>'):
+            values[first:code + 1] = [value] * (code + 1 - first)
+        else:
+            values[code] = value
+
+    return values
+
+
+def scripts(ucd):
+    """script names, 'Unknown' first and the others sorted, and the script of every code point"""
+    ranges = [(code_points(fields[0]), fields[1]) for fields in records(os.path.join(ucd, 'Scripts.txt'))]
+    names = ['Unknown'] + sorted(set(name for _, name in ranges))
+    values = [0] * (MAX_CODE_POINT + 1)
+
+    for (lower, upper), name in ranges:
+        values[lower:upper + 1] = [names.index(name)] * (upper + 1 - lower)
+
+    return names, values
+
+
+def runs(values):
+    """first code point of every run of equal values, with it's value"""
+    return [(code, value) for code, value in enumerate(values) if code == 0 or values[code - 1] != value]
+
+
+def case_ranges(ucd):
+    """ranges of code points mapping to the next code point of their orbit by the same delta"""
+    orbits = {}
+
+    # characters folding to the same one form an orbit, walked in ascending order and back to the first one
+    for fields in records(os.path.join(ucd, 'CaseFolding.txt')):
+        if fields[1] in ('C', 'S'):
+            code = int(fields[0], 16)
+            folded = int(fields[2], 16)
+            orbits.setdefault(folded, {folded}).add(code)
+
+    deltas = {}
+
+    for orbit in orbits.values():
+        orbit = sorted(orbit)
+
+        for code, next in zip(orbit, orbit[1:] + orbit[:1]):
+            deltas[code] = next - code
+
+    ranges = []
+
+    for code in sorted(deltas):
+        delta = deltas[code]
+
+        if ranges and ranges[-1][1] + 1 == code:
+            lower, upper, last = ranges[-1]
+
+            if last == delta:
+                ranges[-1] = (lower, code, delta)
+                continue
+
+            # pairs following each other merge into an alternating range
+            if last is ALTERNATE and delta == (1 if (code - lower) % 2 == 0 else -1):
+                ranges[-1] = (lower, code, ALTERNATE)
+                continue
+
+            if lower + 1 == code and last == 1 and delta == -1:
+                ranges[-1] = (lower, code, ALTERNATE)
+                continue
+
+        ranges.append((code, code, delta))
+
+    # a single pair is kept as two ranges of their own
+    result = []
+
+    for lower, upper, delta in ranges:
+        if delta is ALTERNATE and upper == lower + 1:
+            result += [(lower, lower, 1), (upper, upper, -1)]
+        else:
+            result.append((lower, upper, delta))
+
+    return result
+
+
+def format_words(words):
+    lines = []
+
+    for i in range(0, len(words), 8):
+        lines.append('    ' + ' '.join('0x%08x,' % word for word in words[i:i + 8]))
+
+    return '\n'.join(lines)
+
+
+def format_runs(values):
+    return format_words([code << 8 | value for code, value in runs(values)])
+
+
+def format_names(names):
+    return '\n'.join('    "%s",' % name for name in names)
+
+
+def format_case_ranges(ranges):
+    return '\n'.join('    { 0x%05x, 0x%05x, %s },' % (lower, upper, 'Alternate' if delta is ALTERNATE else delta)
+                     for lower, upper, delta in ranges)
+
+
+def replace(source, name, body):
+    pattern = re.compile(r'(static const [^\n]*\b%s\[\] =\n\{\n)(.*?)(\n\};)' % name, re.S)
+
+    if not pattern.search(source):
+        raise SystemExit('table %s not found' % name)
+
+    return pattern.sub(lambda match: match.group(1) + body + match.group(3), source, count=1)
+
+
+def main():
+    if len(sys.argv) not in (2, 3):
+        raise SystemExit(__doc__)
+
+    ucd = sys.argv[1]
+    path = sys.argv[2] if len(sys.argv) == 3 else os.path.join(os.path.dirname(__file__), '..', 'src', 'Unicode.cpp')
+    names, values = scripts(ucd)
+
+    with open(path, encoding='utf-8') as file:
+        source = file.read()
+
+    source = replace(source, 'CaseRanges', format_case_ranges(case_ranges(ucd)))
+    source = replace(source, 'ScriptNames', format_names(names))
+    source = replace(source, 'CategoryRuns', format_runs(categories(ucd)))
+    source = replace(source, 'ScriptRuns', format_runs(values))
+
+    with open(path, 'w', encoding='utf-8') as file:
+        file.write(source)
+
+
+if __name__ == '__main__':
+    main()